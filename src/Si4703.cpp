@@ -5,11 +5,51 @@
 
 #include "Si4703.h"
 #include "gpio.h"
+#include <avr/interrupt.h>
 #include <util/delay.h>
 #include "twi.h"
 
 Si4703 radio;
 
+#if (SI4703_RDS_FIFO_SIZE & (SI4703_RDS_FIFO_SIZE - 1)) != 0
+# error "SI4703_RDS_FIFO_SIZE musí byť mocnina 2"
+#endif
+
+/// Maska indexov RDS fronty.
+#define RDS_FIFO_MASK (SI4703_RDS_FIFO_SIZE - 1)
+
+/// Čas v ms od štartu (implementovaný v main.cpp).
+extern unsigned long timer_millis();
+
+//-----------------------------------------------------------------------------------------------------------------------------------
+// Prerušenie z GPIO2 (STC/RDS) – pin-change na porte C
+//-----------------------------------------------------------------------------------------------------------------------------------
+/// Maska pinu na porte C, na ktorom je GPIO2 (0 = prerušenie nepoužité).
+static uint8_t si4703_int_mask = 0;
+/// Príznak nastavený v ISR pri impulze na GPIO2 (STC alebo RDS ready).
+static volatile uint8_t si4703_irq = 0;
+
+/**
+ * @brief Obsluha pin-change prerušenia portu C.
+ *
+ * GPIO2 Si4703 generuje pri STC/RDS impulz do nuly (min. 5 ms),
+ * zaznamenáva sa preto len zostupná hrana. Samotný dôvod (STC alebo RDS)
+ * rozlišuje ovládač podľa toho, či práve beží tuning/seek (@ref Si4703::onGpio2).
+ */
+ISR(PCINT1_vect)
+{
+  if (si4703_int_mask && !(PINC & si4703_int_mask))
+    radio.onGpio2();
+}
+
+/**
+ * @brief Dokončenie asynchrónneho čítania RDS skupiny (v prerušení TWI).
+ */
+static void si4703_rds_done(twi_xfer_t *x)
+{
+  radio.onRdsFetched();
+}
+
 //-----------------------------------------------------------------------------------------------------------------------------------
 // Inicializácia triedy Si4703 – uloženie parametrov a nastavení
 //-----------------------------------------------------------------------------------------------------------------------------------
@@ -28,6 +68,7 @@ Si4703 radio;
  * @param skcnt   Prah impulznej detekcie pri seeku.
  * @param sksnr   SNR prah pre seek.
  * @param agcd    Nastavenie AGC (0 = povolené, 1 = zakázané).
+ * @param bus     Rozhranie čipu (@ref BUS_2WIRE, @ref BUS_3WIRE_GPIO, @ref BUS_3WIRE_SPI).
  */
 Si4703::Si4703(
     int rstPin,
@@ -41,7 +82,8 @@ Si4703::Si4703(
     int seekth,
     int skcnt,
     int sksnr,
-    int agcd
+    int agcd,
+    int bus
 )
 {
   // Výber pinov MCU
@@ -49,6 +91,7 @@ Si4703::Si4703(
   _sdioPin  = sdioPin;  // I2C dátová linka
   _sclkPin  = sclkPin;  // I2C hodinová linka
   _intPin   = intPin;   // Pin pre STC/RDS interrupt
+  _bus      = bus;      // 2-wire / 3-wire rozhranie
 
   // Nastavenia pásma
   _band     = band;	    // Kód pásma
@@ -65,126 +108,376 @@ Si4703::Si4703(
   _skcnt    =	skcnt;   // Prah impulznej detekcie
   _sksnr    =	sksnr;	// SNR prah pre seek
   _agcd     = agcd;     // AGC disable flag
+
+  // Automat ladenia/seeku
+  _op       = OP_IDLE;
+  _opPhase  = OP_IDLE;
+  _opFlags  = 0;
+  _seekDir  = SEEK_UP;
+  _tuneFreq = 0;
+  _opPollMs = 0;
+  _opStartMs = 0;
+  _opLimitMs = 0;
+  _rdsPollMs  = 0;
+
+  // RDS fronta – prázdna, zachytávanie sa povolí po powerUp
+  _rdsHead     = 0;
+  _rdsTail     = 0;
+  _rdsCapture  = false;
+  resetRdsFifoStats();
+
+  // Čítanie RDS skupiny z prerušenia – 12 bajtov od STATUSRSSI
+  _rdsXfer.addr   = I2C_ADDR;
+  _rdsXfer.flags  = 0;
+  _rdsXfer.reg    = 0;
+  _rdsXfer.wbuf   = 0;
+  _rdsXfer.wlen   = 0;
+  _rdsXfer.rbuf   = _rdsBuf;
+  _rdsXfer.rlen   = sizeof(_rdsBuf);
+  _rdsXfer.count  = 0;
+  _rdsXfer.status = TWI_XF_OK;
+  _rdsXfer.done   = si4703_rds_done;
+
+  // Power-up/štart bez čakania
+  _pwrPhase     = PWR_IDLE;
+  _pwrMs        = 0;
+  _startPending = false;
+
+  // Rýchlosť I2C zbernice
+  _sclHz        = SI4703_SCL_HZ;
+  _busFault     = false;
+
+  // Pohotovostný režim
+  _standby      = false;
+  _standbyFreq  = 0;
+
+  // Cache registrov – platná až po prvom načítaní z čipu
+  _cacheValid = false;
+  resetBusStats();
 }
 
 //-----------------------------------------------------------------------------------------------------------------------------------
-// Načítanie celého registračného priestoru (0x00 - 0x0F) do shadow štruktúry
-// Číta sa v poradí: 0A,0B,0C,0D,0E,0F,00,01,02,03,04,05,06,07,08,09 = 16 slov = 32 bajtov
+// Načítanie časti registračného priestoru do shadow štruktúry
+// Čip číta vždy od 0x0A: 0A,0B,0C,0D,0E,0F,00,01,02,03,04,05,06,07,08,09 – stačí prečítať len potrebný počet slov
 //-----------------------------------------------------------------------------------------------------------------------------------
 /**
- * @brief Načíta všetkých 16 registrov Si4703 do internej „shadow“ štruktúry.
+ * @brief Načíta prvých @p words registrov Si4703 (od 0x0A) do internej „shadow“ štruktúry.
  *
- * Funkcia:
- *  - otvorí I2C komunikáciu v režime čítania,
- *  - prečíta 32 bajtov v definovanom poradí,
- *  - poskladá z nich 16-bitové slová do poľa @c shadow.word.
+ * Konfiguračné registre 0x02–0x07 vlastní ovládač – po naplnení cache
+ * (@ref loadShadow) sa už z čipu nečítajú, čítanie sa preto obmedzí
+ * najviac na @ref STATUS_WORDS slov (STATUSRSSI … CHIPID).
+ *
+ * Typické dĺžky:
+ *  - 1 slovo  (2 B) – STATUSRSSI (RSSI, STC, SFBL, ST),
+ *  - 2 slová  (4 B) – STATUSRSSI + READCHAN,
+ *  - 6 slov  (12 B) – STATUSRSSI … RDSD.
+ *
+ * Neúspešné čítanie sa opakuje podľa @ref busRetry.
+ *
+ * @param words Počet 16-bitových slov, ktoré sa majú prečítať (1–16).
+ * @return true pri úspechu; false, ak čip neodpovedal ani po @ref I2C_FAIL_MAX pokusoch (shadow ostáva).
  */
-void Si4703::getShadow()
+bool Si4703::getShadow(uint8_t words)
 {
-    // Adresa slave zariadenia posunutá o 1 bit doľava, doplnený R/W bit (1 = READ)
-    uint8_t slave_read_addr = (I2C_ADDR << 1) | TWI_READ; 
-    
-    // Začiatok komunikácie a odoslanie SLA+R
-    twi_start();
-    if (twi_write(slave_read_addr) != TWI_ACK) {
-        // Zariadenie neodpovedalo ACK – ukončíme komunikáciu
-        twi_stop();
-        return;
+    if (_cacheValid && words > STATUS_WORDS) words = STATUS_WORDS;
+    if (words == 0) return true;
+
+    // Čisté čítanie (SLA+R) – čip vracia registre od 0x0A, MSB prvý
+    uint8_t buf[2 * SHADOW_WORDS];
+    uint8_t status;
+    uint8_t attempt = 0;
+
+    do {
+        _stats.reads++;
+        _stats.rxBytes++;
+        status = busRead(buf, words);
+    } while (busRetry(status, ++attempt));
+
+    if (status != TWI_XF_OK)
+        return false;           // Zariadenie neodpovedalo – shadow ostáva
+
+    // Zloženie 16-bitových slov z MSB a LSB
+    for (uint8_t i = 0; i < words; i++)
+        shadow.word[i] = ((uint16_t)buf[2 * i] << 8) | buf[2 * i + 1];
+    _stats.rxBytes += 2 * words;
+    return true;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------
+// Politika opakovania I2C transakcií
+//-----------------------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Vyhodnotí výsledok I2C transakcie a rozhodne, či ju zopakovať.
+ *
+ * Neúspešná transakcia (NACK, timeout so zotavením zbernice, chyba zbernice)
+ * sa opakuje, kým počet pokusov nedosiahne @ref I2C_FAIL_MAX. Ak zlyhá aj
+ * posledný pokus, ovládač hlási poruchu zbernice (@ref isBusFault) až do
+ * ďalšej úspešnej transakcie.
+ *
+ * @param status  Stav práve dokončeného pokusu (TWI_XF_*).
+ * @param attempt Poradie pokusu (od 1).
+ * @return true = transakciu zopakovať.
+ */
+bool Si4703::busRetry(uint8_t status, uint8_t attempt)
+{
+    if (status == TWI_XF_OK) {
+        _busFault = false;
+        return false;
     }
-    
-    // Čítanie 32 bajtov (16 16-bitových registrov)
-    for (int i = 0; i < 16; i++) {
-        uint8_t msb, lsb;
-
-        // Čítanie horného bajtu (MSB) – všetky okrem posledného LSB dostanú ACK
-        msb = twi_read(TWI_ACK);
-
-        // Čítanie dolného bajtu (LSB)
-        if (i < 15) {
-            // LSB 1. až 15. slova dostanú ACK, aby slave pokračoval ďalším bajtom
-            lsb = twi_read(TWI_ACK);
-        } else {
-            // LSB 16. slova je posledný bajt – posielame NACK
-            lsb = twi_read(TWI_NACK);
-        }
-        
-        // Zloženie 16-bitového slova z MSB a LSB
-        shadow.word[i] = ((uint16_t)msb << 8) | lsb;
+    if (attempt < I2C_FAIL_MAX) {
+        _stats.retries++;
+        return true;
     }
+    _stats.failures++;
+    _busFault = true;
+    return false;
+}
 
-    // Ukončenie I2C komunikácie
-    twi_stop();
+//-----------------------------------------------------------------------------------------------------------------------------------
+// Naplnenie cache – jediné čítanie celého registračného priestoru (32 bajtov)
+//-----------------------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Načíta všetkých 16 registrov a od tohto momentu považuje konfiguračné registre za vlastnené ovládačom.
+ *
+ * Volá sa po resete čipu (napr. z @ref powerUp), keď cache ešte nie je platná.
+ * Načítané hodnoty 0x02–0x07 sa zároveň uložia ako „zapísané“, takže
+ * ďalší @ref putShadow pošle len skutočne zmenené registre.
+ */
+void Si4703::loadShadow(void)
+{
+    _cacheValid = false;
+    getShadow(SHADOW_WORDS);
+
+    for (uint8_t i = 0; i < CONFIG_WORDS; i++)
+        _committed[i] = shadow.word[CONFIG_FIRST + i];
+    _cacheValid = true;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------
+// Kontrola konzistencie – zodpovedajú registre čipu cache?
+//-----------------------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Načíta všetky registre a porovná konfiguračné registre s poslednými zapísanými hodnotami.
+ *
+ * Po resete alebo poklese napätia (brown-out) má čip predvolené registre –
+ * minimálne XOSCEN (0x07), ktorý ovládač vždy nastavuje, sa nezhoduje.
+ * Bity, ktoré čip mení sám (ENABLE/DISABLE po power-downe, SEEK, TUNE),
+ * sa neporovnávajú.
+ *
+ * Registre sa naozaj čítajú z čipu (všetkých 16 slov – @ref getShadow
+ * pri platnej cache inak 0x02–0x07 vynechá). Shadow po volaní obsahuje
+ * hodnoty z čipu.
+ *
+ * @return true, ak čip odpovedal a drží konfiguráciu z cache.
+ */
+bool Si4703::checkRegisters(void)
+{
+  POWERCFG_t  pwrMask;
+  CHANNEL_t   chanMask;
+
+  pwrMask.word          = 0xFFFF;
+  pwrMask.bits.ENABLE   = 0;
+  pwrMask.bits.DISABLE  = 0;
+  pwrMask.bits.SEEK     = 0;
+  chanMask.word         = 0xFFFF;
+  chanMask.bits.TUNE    = 0;
+
+  _cacheValid = false;                            // Čítať aj 0x02–0x07, nie len stav
+  bool ok = getShadow(SHADOW_WORDS);
+  _cacheValid = true;
+  if (!ok) return false;                          // Čip neodpovedá – nie je čo porovnať
+
+  for (uint8_t i = 0; i < CONFIG_WORDS; i++) {
+    uint16_t mask = (i == 0) ? pwrMask.word : (i == 1) ? chanMask.word : 0xFFFF;
+    if ((shadow.word[CONFIG_FIRST + i] ^ _committed[i]) & mask) return false;
+  }
+  return true;
 }
 
 //-----------------------------------------------------------------------------------------------------------------------------------
-// Zápis riadiacich registrov (0x02 až 0x07) z shadow štruktúry do Si4703
+// Zápis riadiacich registrov (0x02 až posledný zmenený) z shadow štruktúry do Si4703
 // Čip predpokladá, že prvý zapisovaný register je 0x02 a ďalej sa adresa inkrementuje
 //-----------------------------------------------------------------------------------------------------------------------------------
 /**
- * @brief Zapíše riadiace registre zo shadow štruktúry do čipu Si4703.
+ * @brief Zapíše zmenené riadiace registre zo shadow štruktúry do čipu Si4703.
+ *
+ * Funkcia porovná shadow s poslednými zapísanými hodnotami (@ref _committed):
+ *  - zápis začína vždy registrom 0x02 (index 8 v poli @c shadow.word),
+ *  - končí posledným registrom, ktorý sa zmenil (najviac 0x07),
+ *  - ak sa nezmenil žiadny register, na zbernicu sa nepošle nič.
  *
- * Funkcia zapisuje subset registrov:
- *  - postupne od indexu 8 po 13 v poli @c shadow.word,
- *  - každý register ako MSB a LSB bajt cez I2C.
+ * Neúspešný zápis sa opakuje podľa @ref busRetry – opakovanie pošle znovu
+ * registre od 0x02 po posledný, ktorý čip ešte nepotvrdil.
  *
- * @return 0 pri úspechu, nenulový kód pri chybe (NACK po adrese alebo bajte).
+ * @return 0 pri úspechu, nenulový kód pri chybe (NACK po adrese alebo bajte, timeout).
  */
 uint8_t Si4703::putShadow()
 {
-    // Adresa slave zariadenia posunutá o 1 bit doľava, R/W bit = zápis
-    uint8_t slave_write_addr = (I2C_ADDR << 1) | TWI_WRITE; 
-    uint8_t result = 0; // Výsledok posledného twi_write
+    uint8_t     buf[2 * CONFIG_WORDS];
+    uint8_t     status;
+    uint8_t     written;
+    uint8_t     attempt = 0;
+
+    do {
+        // Nájdenie posledného zmeneného registra
+        uint8_t count = CONFIG_WORDS;
+        while (count > 0 && shadow.word[CONFIG_FIRST + count - 1] == _committed[count - 1])
+            count--;
+        if (count == 0) return 0;   // Nič sa nezmenilo
+
+        // Zmenené registre – horný a dolný bajt, od 0x02
+        for (uint8_t i = 0; i < count; i++) {
+            uint16_t word = shadow.word[CONFIG_FIRST + i];
+            buf[2 * i]     = word >> 8;
+            buf[2 * i + 1] = word & 0x00FF;
+        }
 
-    // 1. Začiatok komunikácie (START)
-    twi_start();
-    
-    // 2. Odoslanie SLA+W
-    result = twi_write(slave_write_addr); 
-    
-    // Kontrola ACK od slave
-    if (result != TWI_ACK) {
-        twi_stop();
-        return 1; // Chyba: NACK po adrese
-    }
+        _stats.writes++;
+        _stats.txBytes += 1 + 2 * count;
 
-    // 3. Odoslanie 6 registrov (12 bajtov) – horný a dolný bajt
-    for (int i = 8; i < 14; i++) { 
-        // Horný bajt
-        uint8_t upper_byte = shadow.word[i] >> 8;
-        result = twi_write(upper_byte); 
-        if (result != TWI_ACK) {
-            twi_stop();
-            return 2; // Chyba: NACK po hornom bajte
-        }
-        
-        // Dolný bajt
-        uint8_t lower_byte = shadow.word[i] & 0x00FF;
-        result = twi_write(lower_byte); 
-        if (result != TWI_ACK) {
-            twi_stop();
-            return 3; // Chyba: NACK po dolnom bajte
-        }
-    }
-    
-    // 4. Ukončenie komunikácie (STOP)
-    twi_stop();
+        status = busWrite(buf, count, &written);
+
+        // Za zapísané sa považujú len registre, ktorých oba bajty čip potvrdil
+        for (uint8_t i = 0; i < written / 2; i++)
+            _committed[i] = shadow.word[CONFIG_FIRST + i];
+    } while (busRetry(status, ++attempt));
 
-    // Všetko prebehlo úspešne
-    return 0; 
+    if (status == TWI_XF_OK)        return 0;
+    if (status == TWI_XF_NACK_ADDR) return 1;   // Chyba: NACK po adrese
+    return (written & 1) ? 3 : 2;               // Chyba: NACK po dolnom / hornom bajte
 }
 
 //-----------------------------------------------------------------------------------------------------------------------------------
-// 3-vodičové rozhranie (SCLK, SEN, SDIO) – zatiaľ neimplementované
+// Transport – čítanie a zápis registrov zvoleným rozhraním (2-wire / 3-wire)
 //-----------------------------------------------------------------------------------------------------------------------------------
 /**
- * @brief Inicializácia 3-wire rozhrania (SCLK, SEN, SDIO).
+ * @brief Prečíta @p words registrov v poradí 0x0A, 0x0B, …, 0x09.
+ *
+ * - 2-wire: jedno čisté čítanie (čip začína vždy registrom 0x0A),
+ * - 3-wire: každý register samostatným rámcom v rovnakom poradí.
  *
- * Funkcia je zatiaľ neimplementovaná (TODO). Projekt používa 2-wire (I2C) režim.
+ * @param buf   Výstup – 2 × @p words bajtov, MSB prvý.
+ * @param words Počet registrov (1–16).
+ * @return Stav TWI_XF_* (3-wire nemá potvrdenie, vždy @ref TWI_XF_OK).
+ */
+uint8_t Si4703::busRead(uint8_t *buf, uint8_t words)
+{
+  if (_bus == BUS_2WIRE)
+    return twi_read_block(I2C_ADDR, buf, 2 * words);
+
+  for (uint8_t i = 0; i < words; i++) {
+    uint16_t word = wire3_read((0x0A + i) & 0x0F);
+    buf[2 * i]     = word >> 8;
+    buf[2 * i + 1] = word & 0x00FF;
+  }
+  return TWI_XF_OK;
+}
+
+/**
+ * @brief Zapíše @p words registrov od 0x02.
+ *
+ * - 2-wire: jeden zápis (čip začína vždy registrom 0x02),
+ * - 3-wire: každý register samostatným rámcom.
+ *
+ * @param buf     2 × @p words bajtov, MSB prvý.
+ * @param words   Počet registrov (1–6).
+ * @param written Výstup – počet bajtov, ktoré čip potvrdil.
+ * @return Stav TWI_XF_*.
+ */
+uint8_t Si4703::busWrite(const uint8_t *buf, uint8_t words, uint8_t *written)
+{
+  if (_bus != BUS_2WIRE) {
+    for (uint8_t i = 0; i < words; i++)
+      wire3_write(0x02 + i, ((uint16_t)buf[2 * i] << 8) | buf[2 * i + 1]);
+    *written = 2 * words;
+    return TWI_XF_OK;
+  }
+
+  twi_xfer_t x;
+
+  x.addr   = I2C_ADDR;
+  x.flags  = 0;
+  x.reg    = 0;
+  x.wbuf   = buf;
+  x.wlen   = 2 * words;
+  x.rbuf   = 0;
+  x.rlen   = 0;
+  x.count  = 0;
+  x.status = TWI_XF_OK;
+  x.done   = 0;
+
+  uint8_t status = twi_transfer(&x);
+  *written = x.count;
+  return status;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------
+// Rýchlosť I2C zbernice pre Si4703
+//-----------------------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Nastaví rýchlosť I2C zbernice pre transakcie Si4703.
+ *
+ * Platí aj po ďalšom @ref bus2Wire (reset/obnova čipu).
+ *
+ * @param hz Rýchlosť SCL v Hz (najviac 400 kHz).
+ */
+void Si4703::setBusSpeed(uint32_t hz)
+{
+  _sclHz = hz;
+  twi_set_speed(I2C_ADDR, hz);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------
+// Vynulovanie štatistiky I2C prevádzky
+//-----------------------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Vynuluje počítadlá I2C prevádzky (@ref getBusStats).
+ */
+void Si4703::resetBusStats(void)
+{
+  _stats.rxBytes = 0;
+  _stats.txBytes = 0;
+  _stats.reads   = 0;
+  _stats.writes  = 0;
+  _stats.retries  = 0;
+  _stats.failures = 0;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------
+// 3-vodičové rozhranie (SCLK, SEN, SDIO) – príprava pinov a prepnutie čipu do 3-wire módu
+//-----------------------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Inicializuje 3-wire rozhranie pre Si4703 a prepne čip do 3-wire módu.
+ *
+ * Kroky:
+ *  - privedie čip do resetu so SEN = 1 a SDIO = 1 (signál pre 3-wire mód),
+ *  - pustí reset a inicializuje programové alebo SPI rozhranie (@ref wire3_init).
+ *
+ * Piny 3-wire rozhrania určuje @ref wire3.h (@c _sdioPin a @c _sclkPin sa nepoužívajú).
  */
 void Si4703::bus3Wire(void)
 {
-  // TODO: Implementácia 3-wire rozhrania podľa dokumentácie Si4703
-}			
+  rdsCaptureOff();                   // Počas resetu čip neposiela RDS
+
+  gpio_mode_output(&DDRD, _rstPin);  // Reset pin
+  gpio_write_low(&PORTD, _rstPin);   // Si4703 do resetu
+  wire3_select();                    // SEN = 1, SDIO = 1 -> 3-wire rozhranie
+  _delay_ms(1);                      // Krátke čakanie na ustálenie pinov
+  gpio_write_high(&PORTD, _rstPin);  // Uvoľnenie resetu
+  _delay_ms(1);                      // Čas na naštartovanie čipu
+  _cacheValid = false;               // Po resete má čip predvolené registre
+
+  wire3_init(_bus == BUS_3WIRE_SPI ? WIRE3_SPI : WIRE3_GPIO);
+}
+
+/**
+ * @brief Resetuje čip do rozhrania zvoleného v konštruktore.
+ */
+void Si4703::busInit(void)
+{
+  if (_bus == BUS_2WIRE) bus2Wire();
+  else                   bus3Wire();
+}
 
 //-----------------------------------------------------------------------------------------------------------------------------------
 // 2-vodičové rozhranie (I2C: SCLCK, SDIO) – príprava pinov a prepnutie čipu do 2-wire módu
@@ -199,6 +492,8 @@ void Si4703::bus3Wire(void)
  */
 void Si4703::bus2Wire(void)		
 {
+  rdsCaptureOff();                   // Počas resetu čip neposiela RDS
+
   // Nastavenie smeru pinov
   gpio_mode_output(&DDRD, _rstPin);    // Reset pin
   gpio_mode_output(&DDRC, _sdioPin);   // I2C dátová linka
@@ -209,37 +504,83 @@ void Si4703::bus2Wire(void)
   _delay_ms(1);                      // Krátke čakanie na ustálenie pinov
   gpio_write_high(&PORTD, _rstPin);  // Uvoľnenie resetu so SDIO = LOW
   _delay_ms(1);                      // Čas na naštartovanie čipu
+  _cacheValid = false;               // Po resete má čip predvolené registre
 
   // Inicializácia TWI (I2C) po prechode do 2-wire módu
   twi_init();
+  twi_set_speed(I2C_ADDR, _sclHz);
 }	
 
 //-----------------------------------------------------------------------------------------------------------------------------------
 // Power-up sekvencia – zapnutie oscilátora a povolenie čipu
 //-----------------------------------------------------------------------------------------------------------------------------------
 /**
- * @brief Zapne čip Si4703 – najprv oscilátor, potom samotné rádio.
+ * @brief Zapne čip Si4703 – najprv oscilátor, potom samotné rádio (blokujúco).
  *
- * Kroky:
- *  - načíta registre do shadow,
- *  - povolí kryštálový oscilátor (XOSCEN),
- *  - po čakaní povolí napájanie rádia (ENABLE) a zruší MUTE (DMUTE).
+ * Blokujúca obálka nad @ref beginPowerUp / @ref pollPowerUp.
  */
 void Si4703::powerUp()
 {
-  // Povolenie oscilátora
-  getShadow();                            // Načítanie registrov
+  beginPowerUp();
+  while (!pollPowerUp())
+    _delay_ms(1);
+}
+
+/**
+ * @brief Spustí power-up bez čakania.
+ *
+ * Kroky:
+ *  - ak cache nie je platná (po resete), načíta registre do shadow,
+ *  - povolí kryštálový oscilátor (XOSCEN).
+ *
+ * Ustálenie oscilátora (@ref XOSC_SETTLE_MS) beží na pozadí – medzitým
+ * môže program inicializovať displej a vstupy.
+ */
+void Si4703::beginPowerUp(void)
+{
+  if (!_cacheValid) loadShadow();         // Jediné úplné načítanie registrov
   shadow.reg.TEST1.bits.XOSCEN = 1;       // Povoliť oscilátor
   putShadow();                            // Zápis do registrov
-  _delay_ms(500);                         // Čas na ustálenie oscilátora
+  _pwrPhase = PWR_XOSC;
+  _pwrMs    = timer_millis();
+}
 
-  // Povolenie zariadenia
-  getShadow();                            // Načítanie registrov
-  shadow.reg.POWERCFG.bits.ENABLE   = 1;  // Powerup enable
-  shadow.reg.POWERCFG.bits.DISABLE  = 0;  // Powerdown disable
-  shadow.reg.POWERCFG.bits.DMUTE    = 1;  // Zrušiť mute (audio zapnuté)
-  putShadow();                            // Zápis do registrov
-  _delay_ms(110);                         // Max. čas power-up podľa datasheetu
+/**
+ * @brief Posunie power-up o jeden krok; nikdy nečaká.
+ *
+ *  - PWR_XOSC: po @ref XOSC_SETTLE_MS povolí rádio (ENABLE) a zruší MUTE (DMUTE),
+ *  - PWR_ENABLE: po @ref POWERUP_MS (max. čas power-up podľa datasheetu) je čip pripravený.
+ *
+ * @return true, ak je power-up dokončený (alebo žiadny neprebieha).
+ */
+bool Si4703::pollPowerUp(void)
+{
+  unsigned long now = timer_millis();
+
+  switch (_pwrPhase) {
+  case PWR_XOSC:
+    if (now - _pwrMs < XOSC_SETTLE_MS) return false;
+
+    // Povolenie zariadenia
+    shadow.reg.POWERCFG.bits.ENABLE   = 1;  // Powerup enable
+    shadow.reg.POWERCFG.bits.DISABLE  = 0;  // Powerdown disable
+    shadow.reg.POWERCFG.bits.DMUTE    = 1;  // Zrušiť mute (audio zapnuté)
+    if (_intPin)
+      shadow.reg.SYSCONFIG1.bits.GPIO2 = GPIO_I; // GPIO2 = STC/RDS interrupt (powerDown ho dal do Hi-Z)
+    putShadow();                            // Zápis do registrov
+    _pwrPhase = PWR_ENABLE;
+    _pwrMs    = now;
+    return false;
+
+  case PWR_ENABLE:
+    if (now - _pwrMs < POWERUP_MS) return false;
+    _pwrPhase = PWR_IDLE;
+    rdsCaptureOn();                         // Impulzy GPIO2 odteraz znamenajú RDS ready
+    return true;
+
+  default:
+    return true;
+  }
 }
 
 //-----------------------------------------------------------------------------------------------------------------------------------
@@ -255,7 +596,8 @@ void Si4703::powerUp()
  */
 void Si4703::powerDown()
 {
-  getShadow();                                // Načítanie registrov
+  rdsCaptureOff();                            // Vypnutý čip RDS neposiela
+
   shadow.reg.TEST1.bits.AHIZEN      = 1;      // Audio výstupy do vysokej impedancie
 
   shadow.reg.SYSCONFIG1.bits.GPIO1  = GPIO_Z; // GPIO1 = Hi-Z
@@ -270,26 +612,127 @@ void Si4703::powerDown()
   _delay_ms(2);                               // Krátky čas na vypnutie
 }
 
+//-----------------------------------------------------------------------------------------------------------------------------------
+// Pohotovostný režim – power-down so snímkou konfigurácie
+//-----------------------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Uloží konfiguráciu a vypne rádio; kryštálový oscilátor ostáva bežať.
+ *
+ * Snímka registrov 0x02–0x07 (hlasitosť, mute, pásmo, RDS, GPIO …)
+ * a naladená frekvencia sa uložia v RAM. XOSCEN ostáva nastavený, takže
+ * @ref resume nemusí čakať na ustálenie oscilátora.
+ */
+void Si4703::standby(void)
+{
+  if (_standby) return;
+  if (isBusy()) { cancel(); waitDone(); }         // Seek/tuning by snímku pokazil
+
+  _standbyFreq = getChannel();
+  for (uint8_t i = 0; i < CONFIG_WORDS; i++)
+    _standbyCfg[i] = shadow.word[CONFIG_FIRST + i];
+  _standby = true;
+
+  powerDown();                                    // XOSCEN sa nemení
+}
+
+/**
+ * @brief Obnoví rádio zo snímky uloženej v @ref standby.
+ *
+ * Najprv overí, či čip počas pohotovosti nestratil stav (@ref checkRegisters):
+ *  - teplá obnova: celá snímka 0x02–0x07 (vrátane ENABLE, hlasitosti a mute)
+ *    sa zapíše jediným zápisom, po power-up čase (@ref POWERUP_MS) sa spustí
+ *    neblokujúce preladenie na pôvodnú frekvenciu – spolu ~115 ms,
+ *  - studená obnova (reset/brown-out): reset rozhrania, ustálenie oscilátora
+ *    (@ref XOSC_SETTLE_MS) a potom rovnaký zápis snímky.
+ *
+ * Dokončenie preladenia ohlási @ref poll.
+ *
+ * @return true pri teplej obnove, false ak čip musel byť znovu inicializovaný.
+ */
+bool Si4703::resume(void)
+{
+  if (!_standby) return true;
+
+  bool warm = _cacheValid && checkRegisters();
+
+  if (!warm) {
+    busInit();                                    // Čip v známom stave (reset, predvolené registre)
+    loadShadow();
+    shadow.reg.TEST1.bits.XOSCEN = 1;             // Povoliť oscilátor
+    putShadow();
+    _delay_ms(XOSC_SETTLE_MS);                    // Čas na ustálenie oscilátora
+  }
+
+  // Celá konfigurácia jedným zápisom
+  for (uint8_t i = 0; i < CONFIG_WORDS; i++)
+    shadow.word[CONFIG_FIRST + i] = _standbyCfg[i];
+  shadow.reg.POWERCFG.bits.ENABLE   = 1;          // Powerup enable
+  shadow.reg.POWERCFG.bits.DISABLE  = 0;          // Powerdown disable
+  shadow.reg.POWERCFG.bits.SEEK     = 0;
+  shadow.reg.CHANNEL.bits.TUNE      = 0;
+  putShadow();                                    // 0x02 až posledný odlišný register
+  _delay_ms(POWERUP_MS);                          // Max. čas power-up podľa datasheetu
+  _standby = false;
+  rdsCaptureOn();
+
+  beginTune(_standbyFreq);                        // Preladenie dokončí poll()
+  return warm;
+}
+
 //-----------------------------------------------------------------------------------------------------------------------------------
 // Štart rádia – prepnutie do 2-wire módu, power-up a základná konfigurácia
 //-----------------------------------------------------------------------------------------------------------------------------------
 /**
- * @brief Spustí rádio: nastaví I2C režim, zapne čip a vykoná základnú konfiguráciu.
+ * @brief Spustí rádio: nastaví I2C režim, zapne čip a vykoná základnú konfiguráciu (blokujúco).
+ *
+ * Blokujúca obálka nad @ref beginStart / @ref pollStart.
+ */
+void Si4703::start() 
+{
+  beginStart();
+  while (!pollStart())
+    _delay_ms(1);
+}
+
+/**
+ * @brief Spustí štart rádia bez čakania.
+ *
+ * Inicializuje zvolené rozhranie (reset čipu) a spustí power-up
+ * (@ref beginPowerUp). Zvyšok dokončí @ref pollStart.
+ */
+void Si4703::beginStart(void)
+{
+  busInit();          // Reset čipu do 2-wire (I2C) alebo 3-wire rozhrania
+  beginPowerUp();     // Oscilátor sa ustáľuje na pozadí
+  _startPending = true;
+}
+
+/**
+ * @brief Posunie štart rádia; po dokončení power-upu zapíše konfiguráciu.
+ *
+ * @return true, ak je rádio pripravené.
+ */
+bool Si4703::pollStart(void)
+{
+  if (!pollPowerUp()) return false;
+  if (_startPending) {
+    _startPending = false;
+    configure();
+  }
+  return true;
+}
+
+/**
+ * @brief Základná konfigurácia po power-upe.
  *
  * Robí:
- *  - inicializáciu 2-wire rozhrania,
- *  - power-up sekvenciu,
  *  - nastavenie pásma, rozstupu, de-emfázy,
  *  - konfiguráciu seeku, RDS, audio parametrov a GPIO,
- *  - uloženie konfigurácie zápisom shadow registrov.
+ *  - uloženie konfigurácie jedným zápisom shadow registrov.
  */
-void Si4703::start() 
+void Si4703::configure(void)
 {
-  bus2Wire();   // Inicializácia 2-wire rozhrania (I2C)
-  powerUp();    // Power-up čipu
-
-  // Predvolená začiatočná konfigurácia
-  getShadow();                            // Načítanie registrov
+  // Predvolená začiatočná konfigurácia (registre sú v cache po powerUp)
 
   // Výber pásma a regiónu
   setRegion(_band,_space,_de);                      // Nastavenie hraníc pásma
@@ -298,7 +741,7 @@ void Si4703::start()
   shadow.reg.SYSCONFIG1.bits.DE     = _de;          // De-emfáza
 
   // Nastavenie tuningu
-  shadow.reg.SYSCONFIG1.bits.STCIEN = 0;            // Interrupt STC vypnutý
+  shadow.reg.SYSCONFIG1.bits.STCIEN = _intPin ? 1 : 0; // Interrupt STC len ak je pripojený GPIO2
 
   // Nastavenie seek režimu
   shadow.reg.POWERCFG.bits.SEEK     = 0;            // Seek vypnutý
@@ -310,8 +753,8 @@ void Si4703::start()
   shadow.reg.SYSCONFIG1.bits.AGCD   = _agcd;        // AGC disable
 
   // Nastavenie RDS
-  shadow.reg.SYSCONFIG1.bits.RDSIEN = 0;            // RDS interrupt vypnutý
-  shadow.reg.POWERCFG.bits.RDSM     = 0;            // RDS štandardný režim
+  shadow.reg.SYSCONFIG1.bits.RDSIEN = _intPin ? 1 : 0; // RDS interrupt len ak je pripojený GPIO2
+  shadow.reg.POWERCFG.bits.RDSM     = 1;            // RDS verbose režim – BLERA–BLERD pre dekodér
   shadow.reg.SYSCONFIG1.bits.RDS    = 1;            // RDS povolené
 
   // Nastavenie audia
@@ -328,10 +771,46 @@ void Si4703::start()
 
   // Nastavenie GPIO pinov
   shadow.reg.SYSCONFIG1.bits.GPIO1  = GPIO_Z;       // GPIO1 = Hi-Z
-  shadow.reg.SYSCONFIG1.bits.GPIO2  = GPIO_Z;       // GPIO2 = Hi-Z
+  shadow.reg.SYSCONFIG1.bits.GPIO2  = _intPin ? GPIO_I : GPIO_Z; // GPIO2 = STC/RDS interrupt alebo Hi-Z
   shadow.reg.SYSCONFIG1.bits.GPIO3  = GPIO_Z;       // GPIO3 = Hi-Z
 
   putShadow();                                      // Zápis konfigurácie do čipu
+  intInit();                                        // Pin-change prerušenie pre GPIO2
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------
+// Príprava prerušenia z GPIO2 (STC/RDS interrupt)
+//-----------------------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Nastaví pin MCU pre GPIO2 ako vstup s pull-upom a povolí pin-change prerušenie.
+ *
+ * Pin leží na porte C (PCINT8–PCINT13, vektor PCINT1). Ak @c _intPin = 0,
+ * prerušenie sa nepoužije a STC sa zisťuje čítaním STATUSRSSI.
+ */
+void Si4703::intInit(void)
+{
+  if (!_intPin) return;
+
+  gpio_mode_input_pullup(&DDRC, _intPin);   // GPIO2 je open-drain impulz do nuly
+  si4703_int_mask = (1 << _intPin);
+  si4703_irq      = 0;
+  PCMSK1 |= si4703_int_mask;                // Povolenie pinu v maske PCINT1
+  PCICR  |= (1 << PCIE1);                   // Povolenie skupiny PCINT1 (port C)
+}
+
+/**
+ * @brief Prevezme príznak z prerušenia GPIO2.
+ *
+ * @return true, ak od posledného volania prišiel impulz STC/RDS.
+ */
+bool Si4703::takeIrq(void)
+{
+  uint8_t old = SREG;
+  cli();
+  uint8_t irq = si4703_irq;
+  si4703_irq  = 0;
+  SREG = old;
+  return irq;
 }
 
 //-----------------------------------------------------------------------------------------------------------------------------------
@@ -400,7 +879,6 @@ void Si4703::setRegion(int band,   // Band Range
  */
 void Si4703::setMono(bool en)
 {
-  getShadow();                            // Načítanie registrov
   shadow.reg.POWERCFG.bits.MONO = en;     // Nastavenie mono bitu
   putShadow();                            // Zápis registrov
 }	
@@ -415,7 +893,6 @@ void Si4703::setMono(bool en)
  */
 bool Si4703::getMono(void)
 {
-  getShadow();                              // Načítanie registrov
   return (shadow.reg.POWERCFG.bits.MONO);   // Stav mono bitu
 }	
 
@@ -429,7 +906,6 @@ bool Si4703::getMono(void)
  */
 void Si4703::setMute(bool en)
 {
-  getShadow();                              // Načítanie registrov
   shadow.reg.POWERCFG.bits.DMUTE = en;      // Nastavenie DMUTE
   putShadow();                              // Zápis registrov
 }	
@@ -444,7 +920,6 @@ void Si4703::setMute(bool en)
  */
 bool Si4703::getMute(void)
 {
-  getShadow();                              // Načítanie registrov
   return (shadow.reg.POWERCFG.bits.DMUTE);  // Stav DMUTE
 }	
 
@@ -458,7 +933,6 @@ bool Si4703::getMute(void)
  */
 void Si4703::setVolExt(bool en)
 {
-  getShadow();                              // Načítanie registrov
   shadow.reg.SYSCONFIG3.bits.VOLEXT = en;   // Nastavenie VOLEXT
   putShadow();                              // Zápis registrov
 }
@@ -473,7 +947,6 @@ void Si4703::setVolExt(bool en)
  */
 bool Si4703::getVolExt(void)
 {
-  getShadow();                               // Načítanie registrov
   return (shadow.reg.SYSCONFIG3.bits.VOLEXT);// Stav VOLEXT
 }
 
@@ -487,7 +960,6 @@ bool Si4703::getVolExt(void)
  */
 int Si4703::getVolume(void)
 {
-  getShadow();                                // Načítanie registrov
   return (shadow.reg.SYSCONFIG2.bits.VOLUME);
 }
 
@@ -498,14 +970,13 @@ int Si4703::getVolume(void)
  * @brief Nastaví hlasitosť na zadanú hodnotu v rozsahu 0–15.
  *
  * Hodnota sa orezáva do povoleného rozsahu. Po nastavení vráti
- * aktuálnu hlasitosť načítanú z registra.
+ * aktuálnu hlasitosť z cache registrov (bez ďalšieho čítania z čipu).
  *
  * @param volume Hodnota hlasitosti 0–15.
  * @return Skutočne nastavená hlasitosť.
  */
 int Si4703::setVolume(int volume)
 {
-  getShadow();                                // Načítanie registrov
   if (volume < 0 ) volume = 0;                // Orezanie spodnej hranice
   if (volume > 15) volume = 15;               // Orezanie hornej hranice
   shadow.reg.SYSCONFIG2.bits.VOLUME = volume; // Nastavenie hlasitosti
@@ -553,7 +1024,7 @@ int Si4703::decVolume(void)
  */
 int Si4703::getChannel()
 {
-  getShadow();                                // Načítanie registrov
+  getShadow(2);                               // STATUSRSSI + READCHAN (4 bajty)
   
   // Freq = Spacing * Channel + Bottom of Band
   return (_bandSpacing * shadow.reg.READCHAN.bits.READCHAN + _bandStart);  
@@ -565,36 +1036,16 @@ int Si4703::getChannel()
 /**
  * @brief Nastaví naladenú frekvenciu (v kHz) v rámci aktuálneho pásma.
  *
- * Hodnota je orezaná na interval <_bandStart, _bandEnd>. Interný kanál sa vypočíta
- * z rozdielu a rozstupu. Funkcia počká na dokončenie tuningu pomocou STC.
+ * Blokujúca verzia @ref beginTune – počká na dokončenie tuningu (STC).
+ * Prípadný bežiaci seek sa najprv zruší.
  *
  * @param freq Frekvencia v kHz.
  * @return Skutočne naladená frekvencia v kHz.
  */
 int Si4703::setChannel(int freq)
 {
-  if (freq > _bandEnd)    freq = _bandEnd;    // Horná hranica
-  if (freq < _bandStart)  freq = _bandStart;  // Spodná hranica
-
-  // Freq     = Spacing * Channel + bandStart.
-  // Channel  = (Freq - bandStart) / Spacing
-  getShadow();                              // Načítanie registrov
-  shadow.reg.CHANNEL.bits.CHAN  = (freq - _bandStart) / _bandSpacing;
-  shadow.reg.CHANNEL.bits.TUNE  = 1;        // Spustenie tuningu
-  putShadow();                              // Zápis registrov
-
-  if (shadow.reg.SYSCONFIG1.bits.STCIEN == 0) // STC polling mód
-    while (!getSTC());                       // Čakanie na nastavenie STC
-  else
-    {
-      // Čakanie na HW interrupt STC (ak je použitý)
-      // TODO: implementovať obsluhu interruptu podľa potreby
-    }
-
-  getShadow();                              // Obnovenie registrov
-  shadow.reg.CHANNEL.bits.TUNE  = 0;        // Zrušenie TUNE bitu
-  putShadow();                              // Zápis registrov
-  while (getSTC());                         // Čakanie, kým čip vynuluje STC
+  beginTune(freq);                          // Spustenie tuningu
+  waitDone();                               // Čakanie na STC a jeho vynulovanie
 
   return getChannel();
 }
@@ -646,50 +1097,28 @@ int Si4703::decChannel(void)
  */
 bool Si4703::getSTC(void)
 {
-  getShadow();                                  // Načítanie registrov
+  getShadow(1);                                 // Len STATUSRSSI (2 bajty)
   return (shadow.reg.STATUSRSSI.bits.STC);
 }
 
 //-----------------------------------------------------------------------------------------------------------------------------------
-// Seek na ďalšiu dostupnú stanicu
+// Seek na ďalšiu dostupnú stanicu (blokujúci)
 // Vracia frekvenciu pri úspechu, 0 pri zlyhaní
 //-----------------------------------------------------------------------------------------------------------------------------------
 /**
- * @brief Vykoná seek v zadanom smere a vráti nájdenú frekvenciu.
+ * @brief Vykoná seek v zadanom smere (s obehnutím pásma) a vráti nájdenú frekvenciu.
+ *
+ * Blokujúca verzia @ref beginSeek.
  *
  * @param seekDirection SEEK_UP alebo SEEK_DOWN.
- * @return Naladená frekvencia v kHz pri úspechu, 0 pri zlyhaní (band limit / nič nenašiel).
+ * @return Naladená frekvencia v kHz pri úspechu, 0 pri zlyhaní (nič nenašiel).
  */
 int Si4703::seek(byte seekDirection)
 {
-  getShadow();                                      // Načítanie registrov
-  shadow.reg.POWERCFG.bits.SEEKUP = seekDirection;  // Smer seeku
-  shadow.reg.POWERCFG.bits.SEEK   = 1;              // Spustenie seeku
-  putShadow();                                      // Zápis registrov
+  beginSeek(seekDirection);                         // Spustenie seeku
 
-  if (shadow.reg.SYSCONFIG1.bits.STCIEN == 0)       // Polling STC
-    {
-      while (!getSTC())                             // Čakanie na nastavenie STC
-      {
-        _delay_ms(40);
-        // Sem je možné doplniť zobrazenie progresu podľa READCHAN
-        // TODO: podľa potreby
-      }
-    }
-  else
-    {
-      // Čakanie na interrupt indikujúci STC (Seek/Tune Complete)
-      // TODO: ak sa použije interruptová obsluha
-    }
-  
-  getShadow();                                      // Načítanie registrov
-  bool sfbl = shadow.reg.STATUSRSSI.bits.SFBL;      // Stav SFBL (band limit / fail)
-  shadow.reg.POWERCFG.bits.SEEK   = 0;              // Ukončenie seeku
-  putShadow();                                      // Zápis registrov
-  while (getSTC());                                 // Čakanie na vynulovanie STC
-
-  if (sfbl)  return 0;   // Neúspech: band limit alebo stanica nenájdená
-  return getChannel();   // Úspech: vráti novú frekvenciu
+  if (waitDone() != TUNE_DONE) return 0;            // Neúspech alebo zrušenie
+  return _tuneFreq;                                 // Úspech: nová frekvencia
 }
 
 //-----------------------------------------------------------------------------------------------------------------------------------
@@ -702,14 +1131,7 @@ int Si4703::seek(byte seekDirection)
  */
 int Si4703::seekUp()
 {
-    int result = seek(SEEK_UP);
-    if (result == 0) {
-        // Pravdepodobne horná hranica alebo bez stanice,
-        // skočíme na spodnú hranicu a skúšame ešte raz
-        setChannel(_bandStart);
-        result = seek(SEEK_UP);
-    }
-    return result;
+    return seek(SEEK_UP);
 }
 
 /**
@@ -719,14 +1141,232 @@ int Si4703::seekUp()
  */
 int Si4703::seekDown()
 {
-    int result = seek(SEEK_DOWN);
-    if (result == 0) {
-        // Pravdepodobne spodná hranica alebo bez stanice,
-        // skočíme na hornú hranicu a skúšame ešte raz
-        setChannel(_bandEnd);
-        result = seek(SEEK_DOWN);
-    }
-    return result;
+    return seek(SEEK_DOWN);
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------
+// Asynchrónne ladenie a seek – spustenie
+//-----------------------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Spustí seek bez čakania na jeho dokončenie.
+ *
+ * Ak seek skončí na hranici pásma (SFBL), automat v @ref poll naladí
+ * opačný okraj pásma a seek zopakuje (rovnako ako pôvodné seekUp/seekDown).
+ * Prípadná bežiaca operácia sa najprv zruší.
+ *
+ * @param dir Smer seeku (@ref SEEK_UP alebo @ref SEEK_DOWN).
+ */
+void Si4703::beginSeek(uint8_t dir)
+{
+  if (isBusy()) { cancel(); waitDone(); }           // Nová operácia preruší starú
+
+  _seekDir = dir;
+  _opFlags = 0;
+  _rds.reset();                                     // RDS patrí starej stanici
+  startPhase(OP_SEEK);
+}
+
+/**
+ * @brief Spustí naladenie frekvencie bez čakania na jeho dokončenie.
+ *
+ * Hodnota je orezaná na interval <_bandStart, _bandEnd>. Prípadná bežiaca
+ * operácia sa najprv zruší.
+ *
+ * @param freq Frekvencia v kHz.
+ */
+void Si4703::beginTune(int freq)
+{
+  if (isBusy()) { cancel(); waitDone(); }           // Nová operácia preruší starú
+
+  if (freq > _bandEnd)    freq = _bandEnd;          // Horná hranica
+  if (freq < _bandStart)  freq = _bandStart;        // Spodná hranica
+
+  // Freq     = Spacing * Channel + bandStart.
+  // Channel  = (Freq - bandStart) / Spacing
+  shadow.reg.CHANNEL.bits.CHAN = (freq - _bandStart) / _bandSpacing;
+  _opFlags = 0;
+  _rds.reset();                                     // RDS patrí starej stanici
+  startPhase(OP_TUNE);
+}
+
+/**
+ * @brief Zapíše TUNE alebo SEEK bit a prejde do stavu čakania na STC.
+ *
+ * @param op @ref OP_TUNE alebo @ref OP_SEEK.
+ */
+void Si4703::startPhase(uint8_t op)
+{
+  if (op == OP_SEEK) {
+    shadow.reg.POWERCFG.bits.SEEKUP = _seekDir;     // Smer seeku
+    shadow.reg.POWERCFG.bits.SEEK   = 1;            // Spustenie seeku
+  } else {
+    shadow.reg.CHANNEL.bits.TUNE    = 1;            // Spustenie tuningu
+  }
+  rdsCaptureOff();                                  // Impulz GPIO2 teraz znamená STC
+  takeIrq();                                        // Starý impulz (napr. RDS) sa na STC nepočíta
+  putShadow();                                      // Zápis registrov
+  _op = op;
+  _opPollMs  = timer_millis();
+  _opStartMs = _opPollMs;
+  // Seek môže prejsť celé pásmo, tuning len jeden kanál (+ rezerva)
+  _opLimitMs = (op == OP_SEEK)
+             ? (uint16_t)STC_CHAN_MS * (uint16_t)((_bandEnd - _bandStart) / _bandSpacing + 1)
+             : 2 * STC_CHAN_MS;
+}
+
+/**
+ * @brief Vynuluje TUNE/SEEK bit a prejde do stavu čakania na vynulovanie STC.
+ *
+ * Vynulovanie SEEK počas bežiaceho seeku ho zároveň preruší.
+ */
+void Si4703::endPhase(void)
+{
+  shadow.reg.POWERCFG.bits.SEEK = 0;                // Ukončenie seeku
+  shadow.reg.CHANNEL.bits.TUNE  = 0;                // Zrušenie TUNE bitu
+  putShadow();                                      // Zápis registrov
+  _opPhase = _op;
+  _op      = OP_CLEAR;
+  _opStartMs = timer_millis();
+  _opLimitMs = 2 * STC_CHAN_MS;                     // STC=0 nasleduje hneď po zápise
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------
+// Asynchrónne ladenie a seek – jeden krok automatu
+//-----------------------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Posunie bežiaci tuning/seek o jeden krok.
+ *
+ * Každé volanie vykoná najviac jedno čítanie STATUSRSSI + READCHAN (4 bajty)
+ * a prípadne jeden zápis riadiacich registrov, takže hlavnú slučku
+ * nikdy nezablokuje. Ak je pripojený GPIO2 (@c _intPin), STC sa nečíta
+ * opakovane – stav sa prečíta až po impulze z prerušenia. Priebeh seeku (aktuálne skúmaná frekvencia)
+ * je dostupný cez @ref getTuneFreq.
+ *
+ * Prechody automatu:
+ *  - OP_TUNE/OP_SEEK: po STC=1 sa vynuluje TUNE/SEEK → OP_CLEAR,
+ *  - OP_CLEAR: po STC=0 je fáza ukončená; neúspešný seek sa raz zopakuje
+ *    od opačného okraja pásma, inak sa ohlási výsledok,
+ *  - fáza, ktorá nedobehne do @c _opLimitMs (tuning 2 × @ref STC_CHAN_MS,
+ *    seek @ref STC_CHAN_MS na kanál pásma – napr. čip v standby STC nikdy
+ *    nenastaví), skončí po poslednom čítaní @ref TUNE_FAIL.
+ *
+ * @return @ref TUNE_BUSY počas behu, jednorazovo @ref TUNE_DONE,
+ *         @ref TUNE_FAIL alebo @ref TUNE_CANCELLED pri ukončení,
+ *         inak @ref TUNE_IDLE.
+ */
+Si4703::tuneStatus_t Si4703::poll(void)
+{
+  if (_op == OP_IDLE) return TUNE_IDLE;
+
+  unsigned long now = timer_millis();
+  bool late = (now - _opStartMs) >= _opLimitMs;     // Posledné čítanie pred TUNE_FAIL
+
+  if (_intPin && _op != OP_CLEAR) {
+    // Režim prerušení – STC čakáme na impulz z GPIO2 bez čítania zbernice;
+    // záložné čítanie len ak hrana dlho nepríde (napr. stratený impulz)
+    if (!takeIrq() && !late && (now - _opPollMs) < INT_FALLBACK_MS) return TUNE_BUSY;
+    _opPollMs = now;
+  }
+
+  if (!getShadow(2)) {                              // STATUSRSSI + READCHAN (4 bajty)
+    // Čip neodpovedá ani po I2C_FAIL_MAX pokusoch – STC by sa nedočkali
+    _op = OP_IDLE;
+    rdsCaptureOn();
+    return TUNE_FAIL;
+  }
+  _tuneFreq = _bandSpacing * shadow.reg.READCHAN.bits.READCHAN + _bandStart;
+  bool stc  = shadow.reg.STATUSRSSI.bits.STC;
+
+  if (_op != OP_CLEAR) {
+    // Čakanie na Seek/Tune Complete
+    if (!stc) return late ? abortPhase() : TUNE_BUSY;
+
+    if (_op == OP_SEEK && shadow.reg.STATUSRSSI.bits.SFBL)
+      _opFlags |= OPF_SFBL;                         // Band limit / nič nenašiel
+    else
+      _opFlags &= ~OPF_SFBL;
+    endPhase();
+    return TUNE_BUSY;
+  }
+
+  // OP_CLEAR – čakanie, kým čip vynuluje STC
+  if (stc) return late ? abortPhase() : TUNE_BUSY;
+  _op = OP_IDLE;
+  rdsCaptureOn();                                   // Mimo ladenia znamená impulz na GPIO2 RDS ready
+
+  if (_opFlags & OPF_CANCEL) return TUNE_CANCELLED;
+
+  if (_opPhase == OP_SEEK && (_opFlags & OPF_SFBL)) {
+    if (_opFlags & OPF_WRAPPED) return TUNE_FAIL;   // Ani po obehnutí nič
+
+    // Hranica pásma – naladíme opačný okraj a seekujeme ešte raz
+    _opFlags |= OPF_WRAPPED | OPF_SEEK_NEXT;
+    int edge = (_seekDir == SEEK_UP) ? _bandStart : _bandEnd;
+    shadow.reg.CHANNEL.bits.CHAN = (edge - _bandStart) / _bandSpacing;
+    startPhase(OP_TUNE);
+    return TUNE_BUSY;
+  }
+
+  if (_opPhase == OP_TUNE && (_opFlags & OPF_SEEK_NEXT)) {
+    _opFlags &= ~OPF_SEEK_NEXT;
+    startPhase(OP_SEEK);                            // Druhý seek od okraja
+    return TUNE_BUSY;
+  }
+
+  return TUNE_DONE;
+}
+
+/**
+ * @brief Ukončí fázu, ktorá nedobehla do @c _opLimitMs.
+ *
+ * Vynuluje TUNE/SEEK bit (ak ešte beží) a automat prejde rovno do
+ * OP_IDLE – na STC sa už nečaká.
+ *
+ * @return @ref TUNE_FAIL.
+ */
+Si4703::tuneStatus_t Si4703::abortPhase(void)
+{
+  if (_op != OP_CLEAR) {
+    shadow.reg.POWERCFG.bits.SEEK = 0;
+    shadow.reg.CHANNEL.bits.TUNE  = 0;
+    putShadow();
+  }
+  _op = OP_IDLE;
+  rdsCaptureOn();
+  return TUNE_FAIL;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------
+// Zrušenie bežiaceho tuningu/seeku
+//-----------------------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Zruší bežiaci seek alebo tuning.
+ *
+ * Vynuluje SEEK/TUNE bit (čip tým seek preruší) a automat prejde do stavu
+ * čakania na STC=0. Nasledujúce @ref poll ohlási @ref TUNE_CANCELLED.
+ */
+void Si4703::cancel(void)
+{
+  if (_op == OP_IDLE) return;
+
+  _opFlags |= OPF_CANCEL;
+  if (_op != OP_CLEAR) endPhase();
+}
+
+/**
+ * @brief Blokujúco dokončí bežiacu operáciu.
+ *
+ * @return Konečný stav operácie (@ref TUNE_DONE, @ref TUNE_FAIL,
+ *         @ref TUNE_CANCELLED alebo @ref TUNE_IDLE, ak nič nebežalo).
+ */
+Si4703::tuneStatus_t Si4703::waitDone(void)
+{
+  tuneStatus_t status;
+
+  while ((status = poll()) == TUNE_BUSY)
+    _delay_ms(POLL_DELAY_MS);                       // Krátka pauza medzi čítaniami STC
+
+  return status;
 }
 
 //-----------------------------------------------------------------------------------------------------------------------------------
@@ -739,22 +1379,201 @@ int Si4703::seekDown()
  */
 bool Si4703::getST(void)
 {
-  getShadow();                              // Načítanie registrov
+  getShadow(1);                             // Len STATUSRSSI (2 bajty)
   return (shadow.reg.STATUSRSSI.bits.ST);   // ST bit
 }
 
 //-----------------------------------------------------------------------------------------------------------------------------------
-// Čítanie RDS – zatiaľ neimplementované
+// Čítanie RDS skupiny a jej dekódovanie
 //-----------------------------------------------------------------------------------------------------------------------------------
 /**
- * @brief Prečíta RDS dáta z registračných blokov.
+ * @brief Odovzdá dekodéru všetky nové RDS skupiny.
  *
- * Funkcia je pripravená ako vstupný bod pre spracovanie RDS (PS, RT a pod.),
- * aktuálne obsahuje len TODO.
+ * Funkcia je určená na volanie v každej iterácii hlavnej slučky:
+ *  - počas tuningu/seeku nerobí nič,
+ *  - s prerušením GPIO2 skupiny číta už obsluha prerušenia do fronty
+ *    (@ref onGpio2) – tu sa len vyprázdni, takže dlhšia pauza v slučke
+ *    skupiny nestratí, kým sa fronta nezaplní,
+ *  - pri 3-wire rozhraní impulz GPIO2 len označí novú skupinu a tá sa
+ *    prečíta tu (rámec 3-wire nesmie začať v prerušení uprostred iného),
+ *  - bez prerušenia číta STATUSRSSI (2 B) najviac raz za @ref RDS_POLL_MS
+ *    a po prečítaní skupiny čaká @ref RDS_HOLD_MS, kým čip RDSR vynuluje;
+ *    samotná skupina = STATUSRSSI … RDSD (12 B) vrátane BLERA–BLERD.
+ *
+ * Dekódované údaje sú dostupné cez @ref getRDS.
  */
 void Si4703::readRDS(void)
 { 
-  // TODO: Implementovať čítanie a dekódovanie RDS blokov RDSA–RDSD
+  if (isBusy()) return;
+
+  if (_intPin && _bus == BUS_2WIRE) {
+    // Slot sa uvoľní pre ISR až po dekódovaní
+    while (_rdsTail != _rdsHead) {
+      uint8_t tail = _rdsTail;
+      _rds.decode(_rdsFifo[tail].block, _rdsFifo[tail].bler);
+      _rdsTail = (tail + 1) & RDS_FIFO_MASK;
+    }
+    return;
+  }
+
+  if (_intPin) {
+    // 3-wire: impulz GPIO2 skupinu len ohlási, prečíta sa tu
+    if (!takeIrq()) return;
+  } else {
+    unsigned long now = timer_millis();
+    if ((long)(now - _rdsPollMs) < 0) return;       // Ešte nie je čas
+    _rdsPollMs = now + RDS_POLL_MS;
+
+    getShadow(1);                                   // Len STATUSRSSI (RDSR)
+    if (!shadow.reg.STATUSRSSI.bits.RDSR) return;
+    _rdsPollMs = now + RDS_HOLD_MS;
+  }
+
+  getShadow(6);                                     // STATUSRSSI … RDSD (12 bajtov)
+  if (!shadow.reg.STATUSRSSI.bits.RDSR) return;
+  _rds.decode(&shadow.word[2],                      // RDSA, RDSB, RDSC, RDSD
+              packBler(shadow.word[0], shadow.word[1]));
+}
+
+/**
+ * @brief Zbalí chybovosť blokov do formátu dekodéra.
+ *
+ * @param status   Obsah STATUSRSSI (BLERA).
+ * @param readchan Obsah READCHAN (BLERB–BLERD).
+ * @return BLER zbalené ako A[7:6] B[5:4] C[3:2] D[1:0].
+ */
+uint8_t Si4703::packBler(uint16_t status, uint16_t readchan)
+{
+  STATUSRSSI_t st;
+  READCHAN_t   rc;
+
+  st.word = status;
+  rc.word = readchan;
+  return (st.bits.BLERA << 6) | (rc.bits.BLERB << 4) | (rc.bits.BLERC << 2) | rc.bits.BLERD;
+}
+
+//-----------------------------------------------------------------------------------------------------------------------------------
+// RDS fronta plnená z prerušenia GPIO2
+//-----------------------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Zistí, či fronta obsahuje skupinu, ktorú ešte nespracoval @ref readRDS.
+ *
+ * @return true, ak je vo fronte aspoň jedna skupina (bez GPIO2 vždy false).
+ */
+bool Si4703::rdsReady(void)
+{
+  return _rdsHead != _rdsTail;
+}
+
+/**
+ * @brief Obsluha impulzu na GPIO2 (volá ISR(PCINT1_vect) pri prerušeniach zakázaných).
+ *
+ * - počas tuningu/seeku je impulz STC – len sa nastaví príznak pre @ref poll,
+ * - inak ide o RDS ready: čítanie skupiny sa zaradí do fronty TWI
+ *   (@ref twi_submit) a prebehne v prerušení TWI, hneď ako je zbernica
+ *   voľná – obsluha GPIO2 na prenos nečaká.
+ *
+ * Ak predošlé čítanie ešte nie je dokončené, nový impulz sa ignoruje
+ * (RDSR ostáva nastavený a skupina sa prečíta tým čítaním).
+ */
+void Si4703::onGpio2(void)
+{
+  if (!_rdsCapture || _bus != BUS_2WIRE) {
+    si4703_irq = 1;                                 // STC pre automat ladenia, pri 3-wire aj RDS ready
+    return;
+  }
+  if (!twi_done(&_rdsXfer)) return;
+
+  if (twi_busy) _rdsStats.deferred++;               // Čaká za inou prevádzkou
+  twi_submit(&_rdsXfer);
+}
+
+/**
+ * @brief Uloží skupinu prečítanú cez @ref _rdsXfer do fronty.
+ *
+ * Beží v prerušení TWI. Do shadow sa nezapisuje – hlavný program môže byť
+ * práve uprostred práce s ním. Ak je fronta plná, nová skupina sa zahodí
+ * a zvýši sa počítadlo pretečení.
+ */
+void Si4703::onRdsFetched(void)
+{
+  if (_rdsXfer.status != TWI_XF_OK || !_rdsCapture) return;   // Chyba alebo medzitým ladenie
+
+  uint16_t w[6];                                    // STATUSRSSI, READCHAN, RDSA–RDSD
+  for (uint8_t i = 0; i < 6; i++)
+    w[i] = ((uint16_t)_rdsBuf[2 * i] << 8) | _rdsBuf[2 * i + 1];
+
+  STATUSRSSI_t st;
+  st.word = w[0];
+  if (!st.bits.RDSR) return;
+
+  uint8_t head = _rdsHead;
+  uint8_t next = (head + 1) & RDS_FIFO_MASK;
+
+  if (next == _rdsTail) {
+    _rdsStats.overflows++;                          // Plná fronta – slučka nestíha
+    return;
+  }
+
+  rdsGroup_t *g = &_rdsFifo[head];
+  for (uint8_t i = 0; i < 4; i++) g->block[i] = w[2 + i];
+  g->bler  = packBler(w[0], w[1]);
+  _rdsHead = next;
+
+  uint8_t used = (next - _rdsTail) & RDS_FIFO_MASK;
+  if (used > _rdsStats.highWater) _rdsStats.highWater = used;
+  _rdsStats.groups++;
+}
+
+/**
+ * @brief Povolí zachytávanie RDS skupín z prerušenia (len ak je pripojený GPIO2).
+ */
+void Si4703::rdsCaptureOn(void)
+{
+  if (_intPin) _rdsCapture = true;
+}
+
+/**
+ * @brief Zakáže zachytávanie RDS skupín a zahodí nespracované skupiny.
+ *
+ * Volá sa pred tuningom/seekom a pri resete/vypnutí čipu – skupiny vo fronte
+ * patria starej stanici. Čítanie, ktoré ešte beží v TWI, sa po dokončení
+ * zahodí (@ref onRdsFetched kontroluje @c _rdsCapture).
+ */
+void Si4703::rdsCaptureOff(void)
+{
+  uint8_t old = SREG;
+  cli();
+  _rdsCapture  = false;
+  _rdsTail     = _rdsHead;
+  SREG = old;
+}
+
+/**
+ * @brief Atomicky skopíruje štatistiku RDS fronty.
+ *
+ * @param st Cieľová štruktúra.
+ */
+void Si4703::getRdsFifoStats(rdsFifoStats_t *st)
+{
+  uint8_t old = SREG;
+  cli();
+  *st = _rdsStats;
+  SREG = old;
+}
+
+/**
+ * @brief Vynuluje štatistiku RDS fronty.
+ */
+void Si4703::resetRdsFifoStats(void)
+{
+  uint8_t old = SREG;
+  cli();
+  _rdsStats.groups    = 0;
+  _rdsStats.overflows = 0;
+  _rdsStats.deferred  = 0;
+  _rdsStats.highWater = 0;
+  SREG = old;
 }
 
 //-----------------------------------------------------------------------------------------------------------------------------------
@@ -768,8 +1587,6 @@ void Si4703::readRDS(void)
  */
 void Si4703::writeGPIO(int GPIO, int val)
 {
-  getShadow();    // Načítanie registrov
-
   switch (GPIO)
   {
     case GPIO1:
@@ -801,7 +1618,6 @@ void Si4703::writeGPIO(int GPIO, int val)
  */
 int Si4703::getPN()
 {
-  getShadow();    // Načítanie registrov
   return (shadow.reg.DEVICEID.bits.PN);
 }
 
@@ -815,7 +1631,6 @@ int Si4703::getPN()
  */
 int Si4703::getMFGID()
 {
-  getShadow();    // Načítanie registrov
   return (shadow.reg.DEVICEID.bits.MFGID);
 }
 
@@ -829,7 +1644,6 @@ int Si4703::getMFGID()
  */
 int Si4703::getREV()
 {
-  getShadow();    // Načítanie registrov
   return (shadow.reg.CHIPID.bits.REV);
 }
 
@@ -843,7 +1657,6 @@ int Si4703::getREV()
  */
 int Si4703::getDEV()
 {
-  getShadow();    // Načítanie registrov
   return (shadow.reg.CHIPID.bits.DEV);
 }
 
@@ -857,7 +1670,6 @@ int Si4703::getDEV()
  */
 int Si4703::getFIRMWARE()
 {
-  getShadow();    // Načítanie registrov
   return (shadow.reg.CHIPID.bits.FIRMWARE);
 }
 
@@ -910,6 +1722,6 @@ int Si4703::getBandSpace()
  */
 int Si4703::getRSSI(void)
 {
-  getShadow();                              // Načítanie registrov
+  getShadow(1);                             // Len STATUSRSSI (2 bajty)
   return (shadow.reg.STATUSRSSI.bits.RSSI); // RSSI hodnota
 }
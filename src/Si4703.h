@@ -9,6 +9,9 @@
 #include <stdio.h>
 #include <stdint.h>
 #include "gpio.h"
+#include "twi.h"
+#include "wire3.h"
+#include "rds.h"
 
 /**
  * @file
@@ -139,6 +142,57 @@ static const uint8_t BLA_19_37 = 0b10;
 /** @brief Rozsah blend 25–43 dBμV (–6 dB). */
 static const uint8_t BLA_25_43 = 0b11;
 
+// Bus Mode
+
+/** @brief 2-wire rozhranie (I2C cez TWI, zdieľané s OLED) – predvolené. */
+static const uint8_t BUS_2WIRE      = 0;
+/** @brief 3-wire rozhranie programovo na pinoch @ref WIRE3_PORT. */
+static const uint8_t BUS_3WIRE_GPIO = 1;
+/** @brief 3-wire rozhranie cez hardvérové SPI (PB2–PB5, pozri @ref wire3_init). */
+static const uint8_t BUS_3WIRE_SPI  = 2;
+
+/**
+ * @brief Predvolené rozhranie čipu (@ref BUS_2WIRE, @ref BUS_3WIRE_GPIO, @ref BUS_3WIRE_SPI).
+ *
+ * Dá sa zvoliť pri preklade, napr. @c build_flags = -DSI4703_BUS=BUS_3WIRE_SPI.
+ */
+#ifndef SI4703_BUS
+# define SI4703_BUS BUS_2WIRE
+#endif
+
+// STC/RDS Interrupt Pin
+
+/**
+ * @brief Predvolený pin MCU (na porte C) pripojený na GPIO2 Si4703 (0 = nepoužitý, STC sa zisťuje čítaním).
+ *
+ * Pin sa dá zvoliť pri preklade, napr. @c build_flags = -DSI4703_INT_PIN=PC2.
+ * GPIO2 je nastavený ako STC/RDS interrupt (aktívna nula, impulz min. 5 ms)
+ * a zachytáva ho pin-change prerušenie PCINT1.
+ */
+#ifndef SI4703_INT_PIN
+# define SI4703_INT_PIN 0
+#endif
+
+/**
+ * @brief Počet RDS skupín vo fronte plnenej z prerušenia GPIO2 (mocnina 2).
+ *
+ * Jedna skupina zaberá 9 bajtov SRAM; 16 skupín pokryje ~1,4 s vysielania
+ * (RDS ≈ 11,4 skupín/s), kým hlavná slučka frontu nevyprázdni.
+ */
+#ifndef SI4703_RDS_FIFO_SIZE
+# define SI4703_RDS_FIFO_SIZE 16
+#endif
+
+/**
+ * @brief Rýchlosť I2C zbernice pre Si4703 (Hz).
+ *
+ * 2-wire rozhranie čipu podporuje Fast-mode do 400 kHz; TWI prepína
+ * rýchlosť podľa adresy zariadenia (@ref twi_set_speed).
+ */
+#ifndef SI4703_SCL_HZ
+# define SI4703_SCL_HZ 400000UL
+#endif
+
 //------------------------------------------------------------------------------------------------------------
 
 /**
@@ -155,7 +209,8 @@ static const uint8_t BLA_25_43 = 0b11;
  *  - konfiguráciu GPIO pinov Si4703.
  *
  * Komunikácia prebieha cez I2C (2-wire režim) alebo 3-wire rozhranie
- * podľa interných funkcií triedy.
+ * (@ref wire3.h) podľa parametra @c bus konštruktora – čítanie a zápis
+ * registrov idú cez @ref busRead / @ref busWrite.
  */
 class Si4703
 {
@@ -167,7 +222,7 @@ class Si4703
      * @param rstPin   GPIO pin MCU pripojený na reset (RST) Si4703.
      * @param sdioPin  GPIO pin MCU pre I2C SDA (SDIO).
      * @param sclkPin  GPIO pin MCU pre I2C SCL (SCLK).
-     * @param intPin   GPIO pin MCU pre STC/RDS interrupt (0 = nepoužitý).
+     * @param intPin   GPIO pin MCU (port C) pre STC/RDS interrupt z GPIO2 (0 = nepoužitý).
      * @param band     Pásmo rádia (napr. @ref BAND_US_EU, @ref BAND_JPW, @ref BAND_JP).
      * @param space    Rozstup kanálov (napr. @ref SPACE_100KHz).
      * @param de       De-emfáza (napr. @ref DE_75us, @ref DE_50us).
@@ -176,13 +231,14 @@ class Si4703
      * @param skcnt    Prah impulznej detekcie pri seeku (@ref SKCNT_MIN až @ref SKCNT_MAX).
      * @param sksnr    SNR prah seekovania (@ref SKSNR_MIN až @ref SKSNR_MAX).
      * @param agcd     AGC disable (0 = povolené, 1 = zakázané).
+     * @param bus      Rozhranie čipu (@ref BUS_2WIRE, @ref BUS_3WIRE_GPIO, @ref BUS_3WIRE_SPI).
      */
     Si4703(	                
 				// MCU Pins Selection
                 int rstPin    = PD4,            // Reset Pin
 			    int sdioPin   = PC4,           // I2C Data IO Pin
 			    int sclkPin   = PC5,           // I2C Clock Pin
-			    int intPin    = 0,	          // Seek/Tune Complete and RDS interrupt Pin
+			    int intPin    = SI4703_INT_PIN,// Seek/Tune Complete and RDS interrupt Pin
 
                 // Band Settings
 				int band    = BAND_US_EU,	// Band Range
@@ -198,7 +254,10 @@ class Si4703
 				int seekth  = 24,	        // Seek Threshold
 				int skcnt 	= SKSNR_MAX,    // Seek Clicks Number Threshold
 				int sksnr	= SKCNT_MIN,    // Seek Signal/Noise Ratio
-                int agcd	= 0				// AGC disable
+                int agcd	= 0,			// AGC disable
+
+                // Bus Mode
+                int bus     = SI4703_BUS    // 2-wire / 3-wire
     		);
 		
     /// Zapne rádio (napájanie a základná inicializácia).
@@ -207,6 +266,20 @@ class Si4703
 	void	powerDown();			
 	/// Spustí rádio (po powerUp nastaví prevádzkové režimy).
 	void 	start();				
+	/// Spustí power-up bez čakania (XOSCEN); dokončí ho @ref pollPowerUp.
+	void	beginPowerUp(void);
+	/// Posunie power-up (ustálenie oscilátora → ENABLE → power-up čas); true = hotovo.
+	bool	pollPowerUp(void);
+	/// Spustí štart bez čakania (reset, 2-wire, XOSCEN); dokončí ho @ref pollStart.
+	void	beginStart(void);
+	/// Posunie štart; po power-upe zapíše konfiguráciu a vráti true.
+	bool	pollStart(void);
+	/// Prejde do pohotovostného režimu – uloží konfiguráciu 0x02–0x07, oscilátor ostáva bežať.
+	void	standby(void);
+	/// Obnoví rádio z pohotovostného režimu; false = čip medzitým stratil stav (studená obnova).
+	bool	resume(void);
+	/// Zistí, či je rádio v pohotovostnom režime (@ref standby).
+	bool	isStandby(void) const { return _standby; }
 
 	/// Získa číslo dielu (Part Number) z registra DEVICEID.
 	int		getPN();				
@@ -243,6 +316,42 @@ class Si4703
 	/// Seek smerom nadol; vráti naladený kanál alebo 0 pri neúspechu.
 	int 	seekDown(void); 		
 
+	/// Konštanta pre seek smerom nadol.
+	static const uint8_t  	SEEK_DOWN 		= 0; 	
+	/// Konštanta pre seek smerom nahor.
+	static const uint8_t  	SEEK_UP 		= 1;
+
+	/**
+	 * @brief Výsledok kroku asynchrónneho ladenia/seeku (@ref poll).
+	 */
+	enum tuneStatus_t
+	{
+		TUNE_IDLE = 0,		///< Žiadna operácia neprebieha.
+		TUNE_BUSY,			///< Operácia prebieha (pozri @ref getTuneFreq).
+		TUNE_DONE,			///< Operácia práve skončila úspechom.
+		TUNE_FAIL,			///< Seek nenašiel stanicu ani po obehnutí pásma, alebo STC neprišlo včas.
+		TUNE_CANCELLED		///< Operácia bola zrušená cez @ref cancel.
+	};
+
+	/// Spustí seek v smere @p dir (@ref SEEK_UP/@ref SEEK_DOWN) s obehnutím pásma, bez čakania.
+	void	beginSeek(uint8_t dir);
+	/// Spustí naladenie frekvencie @p freq (v kHz), bez čakania.
+	void	beginTune(int freq);
+	/// Posunie bežiacu operáciu o jeden krok (jedno krátke čítanie stavu) a vráti jej stav.
+	tuneStatus_t poll(void);
+	/// Zruší bežiaci seek/tuning; dokončenie ohlási @ref poll ako @ref TUNE_CANCELLED.
+	void	cancel(void);
+	/// Zistí, či prebieha ladenie alebo seek.
+	bool	isBusy(void) const { return _op != OP_IDLE; }
+	/// Frekvencia (kHz) zistená pri poslednom @ref poll – priebeh seeku alebo výsledok.
+	int		getTuneFreq(void) const { return _tuneFreq; }
+	/// RSSI z posledného čítania STATUSRSSI (napr. pri @ref poll), bez prístupu na zbernicu.
+	uint8_t	getLastRSSI(void) const { return shadow.reg.STATUSRSSI.bits.RSSI; }
+	/// Stereo príznak (ST) z posledného čítania STATUSRSSI.
+	bool	getLastST(void) const { return shadow.reg.STATUSRSSI.bits.ST; }
+	/// AFC rail (AFCRL) z posledného čítania STATUSRSSI – kanál je pravdepodobne neplatný.
+	bool	getLastAFCRL(void) const { return shadow.reg.STATUSRSSI.bits.AFCRL; }
+
 	/// Nastaví nútený mono režim (true = mono).
 	void	setMono(bool en);		
 	/// Zistí, či je rádio v mono režime.
@@ -267,8 +376,42 @@ class Si4703
 	/// Zníži hlasitosť o jeden krok; vráti novú hodnotu.
 	int		decVolume(void);		
 
-	/// Prečíta RDS dáta z registrov a spracuje ich (napr. PS/RT).
+	/// Ak je pripravená nová RDS skupina, prečíta ju a odovzdá dekodéru (PS/RT/CT).
 	void	readRDS(void);			
+	/// Dekodér RDS s posledným dekódovaným stavom (PI, PS, RadioText, čas).
+	RdsDecoder& getRDS(void) { return _rds; }
+	/// Zistí, či fronta z prerušenia GPIO2 obsahuje nespracovanú skupinu; bez prerušenia vždy false.
+	bool	rdsReady(void);
+
+	/**
+	 * @brief Jedna RDS skupina zachytená v prerušení (bloky A–D a ich chybovosť).
+	 */
+	struct rdsGroup_t
+	{
+		uint16_t	block[4];		///< RDSA, RDSB, RDSC, RDSD.
+		uint8_t		bler;			///< BLERA–BLERD zbalené ako A[7:6] B[5:4] C[3:2] D[1:0].
+	};
+
+	/**
+	 * @brief Štatistika RDS fronty (od posledného resetu).
+	 */
+	struct rdsFifoStats_t
+	{
+		uint16_t	groups;			///< Počet skupín zapísaných do fronty.
+		uint16_t	overflows;		///< Skupiny zahodené, pretože fronta bola plná.
+		uint16_t	deferred;		///< Čítania RDS, ktoré čakali vo fronte TWI za inou prevádzkou.
+		uint8_t		highWater;		///< Najväčšie zaplnenie fronty.
+	};
+
+	/// Atomicky skopíruje štatistiku RDS fronty do @p st.
+	void	getRdsFifoStats(rdsFifoStats_t *st);
+	/// Vynuluje štatistiku RDS fronty.
+	void	resetRdsFifoStats(void);
+
+	/// Obsluha impulzu na GPIO2 – volá ju ISR(PCINT1_vect), nie aplikácia.
+	void	onGpio2(void);
+	/// Dokončené čítanie RDS skupiny – volá ho TWI prerušenie, nie aplikácia.
+	void	onRdsFetched(void);
 
 	/**
 	 * @brief Zapíše hodnotu na GPIO piny Si4703.
@@ -279,6 +422,35 @@ class Si4703
 	void	writeGPIO(int GPIO,
 					  int val);
 
+	/**
+	 * @brief Štatistika I2C prevádzky ovládača (počítadlá od posledného resetu).
+	 *
+	 * Bajty zahŕňajú aj adresný bajt (SLA+R/W), takže zodpovedajú
+	 * skutočnému vyťaženiu zbernice.
+	 */
+	struct busStats_t
+	{
+		uint32_t	rxBytes;		///< Počet bajtov prenesených pri čítaní registrov.
+		uint32_t	txBytes;		///< Počet bajtov prenesených pri zápise registrov.
+		uint16_t	reads;			///< Počet čítacích transakcií.
+		uint16_t	writes;			///< Počet zápisových transakcií.
+		uint16_t	retries;		///< Počet opakovaných pokusov po chybe.
+		uint16_t	failures;		///< Počet transakcií, ktoré zlyhali aj po @ref I2C_FAIL_MAX pokusoch.
+	};
+
+	/// Vráti štatistiku I2C prevádzky ovládača.
+	const busStats_t& getBusStats(void) const { return _stats; }
+	/// Vynuluje štatistiku I2C prevádzky.
+	void	resetBusStats(void);
+	/// Nastaví rýchlosť I2C zbernice pre Si4703 (Hz, predvolene @ref SI4703_SCL_HZ; len 2-wire).
+	void	setBusSpeed(uint32_t hz);
+	/// Prečíta @p words registrov od STATUSRSSI (napr. na meranie zbernice).
+	void	readRegisters(uint8_t words) { getShadow(words); }
+	/// Vráti zvolené rozhranie čipu (@ref BUS_2WIRE, @ref BUS_3WIRE_GPIO, @ref BUS_3WIRE_SPI).
+	uint8_t	getBusMode(void) const { return _bus; }
+	/// true = posledná transakcia zlyhala aj po @ref I2C_FAIL_MAX pokusoch (čip neodpovedá).
+	bool	isBusFault(void) const { return _busFault; }
+
 //------------------------------------------------------------------------------------------------------------
   private:
     // MCU Pines Selection
@@ -286,6 +458,7 @@ class Si4703
 	int _sdioPin;				///< MCU pin pre I2C SDA (SDIO).
 	int _sclkPin;				///< MCU pin pre I2C SCL (SCLK).
 	int _intPin;				///< MCU pin pre STC/RDS interrupt.
+	uint8_t _bus;				///< Rozhranie čipu (BUS_*).
 
 	// Band Settings
 	int _band;					///< Kód zvoleného pásma.
@@ -308,16 +481,70 @@ class Si4703
 	int _sksnr;					///< SNR prah pre seek.
 	int _agcd;					///< AGC disable (0/1).
 
+	// Tune/Seek state machine
+	uint8_t		_op;			///< Aktuálny stav automatu (OP_*).
+	uint8_t		_opPhase;		///< Fáza (OP_TUNE/OP_SEEK), ktorá sa práve ukončuje v OP_CLEAR.
+	uint8_t		_opFlags;		///< Príznaky OPF_*.
+	uint8_t		_seekDir;		///< Smer bežiaceho seeku.
+	int			_tuneFreq;		///< Frekvencia z posledného čítania READCHAN (kHz).
+	unsigned long _opPollMs;	///< Čas posledného čítania stavu v režime prerušení.
+	unsigned long _opStartMs;	///< Začiatok aktuálnej fázy (OP_TUNE/OP_SEEK/OP_CLEAR).
+	uint16_t	_opLimitMs;		///< Najdlhší čas aktuálnej fázy, potom @ref TUNE_FAIL.
+
+	// RDS
+	RdsDecoder	_rds;			///< Dekodér RDS skupín.
+	unsigned long _rdsPollMs;	///< Čas, odkedy sa smie znovu čítať RDSR (bez prerušenia).
+
+	// RDS fronta plnená z prerušenia (jeden zapisovateľ – ISR, jeden čitateľ – readRDS)
+	rdsGroup_t	_rdsFifo[SI4703_RDS_FIFO_SIZE];	///< Kruhový buffer skupín.
+	volatile uint8_t _rdsHead;	///< Index zápisu (mení len ISR).
+	volatile uint8_t _rdsTail;	///< Index čítania (mení len hlavná slučka).
+	volatile bool _rdsCapture;	///< true = impulz GPIO2 znamená RDS ready (mimo tuningu/seeku).
+	twi_xfer_t	_rdsXfer;		///< Asynchrónne čítanie STATUSRSSI … RDSD z prerušenia.
+	uint8_t		_rdsBuf[12];	///< Prijaté bajty pre @ref _rdsXfer.
+	rdsFifoStats_t _rdsStats;	///< Štatistika fronty.
+
+	// Power-up bez čakania
+	uint8_t		_pwrPhase;		///< Fáza power-upu (PWR_*).
+	bool		_startPending;	///< Po power-upe treba zapísať konfiguráciu (@ref pollStart).
+	unsigned long _pwrMs;		///< Začiatok aktuálnej fázy power-upu.
+
+	// Register cache
+	bool		_cacheValid;	///< true = konfiguračné registre v shadow zodpovedajú čipu.
+	uint16_t	_committed[6];	///< Posledné hodnoty zapísané do registrov 0x02–0x07.
+	busStats_t	_stats;			///< Počítadlá I2C prevádzky.
+	uint32_t	_sclHz;			///< Rýchlosť I2C zbernice (@ref setBusSpeed).
+	bool		_busFault;		///< Posledná transakcia zlyhala aj po opakovaniach (@ref busRetry).
+
+	// Pohotovostný režim
+	bool		_standby;		///< true = rádio je v @ref standby.
+	int			_standbyFreq;	///< Naladená frekvencia pred @ref standby.
+	uint16_t	_standbyCfg[6];	///< Snímka registrov 0x02–0x07 pred @ref standby.
+
 	// Private Functions
 
-	/// Načíta registre čipu do „shadow“ štruktúry.
-	void	getShadow();		
-	/// Zapíše obsah „shadow“ štruktúry späť do registrov čipu.
+	/// Načíta @p words registrov čipu (od 0x0A) do „shadow“ štruktúry.
+	bool	getShadow(uint8_t words = SHADOW_WORDS);
+	/// Politika opakovania: true = zopakovať transakciu (najviac @ref I2C_FAIL_MAX pokusov).
+	bool	busRetry(uint8_t status, uint8_t attempt);
+	/// Zapíše zmenené registre 0x02 až posledný zmenený zo „shadow“ do čipu.
 	byte 	putShadow();		
+	/// Načíta celý registračný priestor a označí cache ako platnú.
+	void	loadShadow(void);
+	/// Načíta registre z čipu a porovná 0x02–0x07 s cache (detekcia resetu/brown-outu).
+	bool	checkRegisters(void);
 	/// Inicializuje 3-wire rozhranie (SCLK, SEN, SDIO).
 	void	bus3Wire(void);		
+	/// Resetuje čip do zvoleného rozhrania (@ref bus2Wire alebo @ref bus3Wire).
+	void	busInit(void);
+	/// Prečíta @p words registrov od 0x0A (MSB prvý) zvoleným rozhraním; vráti stav TWI_XF_*.
+	uint8_t	busRead(uint8_t *buf, uint8_t words);
+	/// Zapíše @p words registrov od 0x02 zvoleným rozhraním; @p written = počet potvrdených bajtov.
+	uint8_t	busWrite(const uint8_t *buf, uint8_t words, uint8_t *written);
 	/// Inicializuje 2-wire (I2C) rozhranie (SCLCK, SDIO).
 	void	bus2Wire(void);		
+	/// Zapíše základnú konfiguráciu po power-upe (pásmo, seek, RDS, audio, GPIO).
+	void	configure(void);
 	/// Nastaví región (pásmo, rozstup a de-emfázu).
 	void	setRegion(int band,	// Band Range
 					  int space,// Band Spacing
@@ -326,17 +553,72 @@ class Si4703
 	bool	getSTC(void);		
 	/// Interná pomocná funkcia na vykonanie seeku v smere seekDir.
 	int 	seek(byte seekDir);	
+	/// Zapíše TUNE/SEEK bity pre začiatok jednej fázy automatu.
+	void	startPhase(uint8_t op);
+	/// Zruší TUNE/SEEK bity a prejde do stavu OP_CLEAR.
+	void	endPhase(void);
+	/// Ukončí fázu, ktorá nedobehla včas; vráti @ref TUNE_FAIL.
+	tuneStatus_t abortPhase(void);
+	/// Blokujúco dokončí bežiacu operáciu; vráti jej výsledok.
+	tuneStatus_t waitDone(void);
+	/// Nastaví pin MCU a pin-change prerušenie pre GPIO2 (STC/RDS interrupt).
+	void	intInit(void);
+	/// Atomicky prevezme príznak prerušenia z GPIO2.
+	bool	takeIrq(void);
+	/// Povolí zachytávanie RDS skupín z prerušenia (len s GPIO2).
+	void	rdsCaptureOn(void);
+	/// Zakáže zachytávanie RDS skupín a zahodí obsah fronty.
+	void	rdsCaptureOff(void);
+	/// Zbalí BLERA–BLERD zo STATUSRSSI a READCHAN do jedného bajtu.
+	static uint8_t packBler(uint16_t status, uint16_t readchan);
 
 	// I2C interface
 	/// I2C adresa čipu Si4703 (7-bitová).
 	static const int  		I2C_ADDR		= 0x10;
-	/// Maximálny počet pokusov o komunikáciu pred zlyhaním.
+	/// Maximálny počet pokusov o jednu I2C transakciu pred zlyhaním (@ref busRetry).
 	static const uint16_t  	I2C_FAIL_MAX 	= 10; 	
 
-	/// Konštanta pre seek smerom nadol.
-	static const uint16_t  	SEEK_DOWN 		= 0; 	
-	/// Konštanta pre seek smerom nahor.
-	static const uint16_t  	SEEK_UP 		= 1;
+	/// Počet slov celého registračného priestoru (0x0A … 0x09).
+	static const uint8_t	SHADOW_WORDS	= 16;
+	/// Počet slov po CHIPID (0x0A … 0x01) – všetko okrem konfiguračných registrov.
+	static const uint8_t	STATUS_WORDS	= 8;
+	/// Index registra POWERCFG (0x02) v poli shadow.word.
+	static const uint8_t	CONFIG_FIRST	= 8;
+	/// Počet konfiguračných registrov 0x02–0x07 vlastnených ovládačom.
+	static const uint8_t	CONFIG_WORDS	= 6;
+
+	/// Stavy asynchrónneho automatu ladenia/seeku.
+	static const uint8_t	OP_IDLE			= 0;	///< Nič neprebieha.
+	static const uint8_t	OP_TUNE			= 1;	///< TUNE=1, čaká sa na STC=1.
+	static const uint8_t	OP_SEEK			= 2;	///< SEEK=1, čaká sa na STC=1.
+	static const uint8_t	OP_CLEAR		= 3;	///< TUNE/SEEK=0, čaká sa na STC=0.
+
+	/// Príznaky asynchrónneho automatu (@ref _opFlags).
+	static const uint8_t	OPF_SEEK_NEXT	= 0x01;	///< Po dokončení tuningu spustiť seek (obehnutie pásma).
+	static const uint8_t	OPF_WRAPPED		= 0x02;	///< Pásmo už bolo obehnuté.
+	static const uint8_t	OPF_SFBL		= 0x04;	///< Posledný seek skončil na hranici pásma.
+	static const uint8_t	OPF_CANCEL		= 0x08;	///< Operácia bola zrušená.
+
+	/// Fázy power-upu (@ref _pwrPhase).
+	static const uint8_t	PWR_IDLE		= 0;	///< Power-up neprebieha.
+	static const uint8_t	PWR_XOSC		= 1;	///< XOSCEN=1, ustáľuje sa oscilátor.
+	static const uint8_t	PWR_ENABLE		= 2;	///< ENABLE=1, čaká sa na power-up čas.
+
+	/// Čas na ustálenie kryštálového oscilátora (ms).
+	static const uint16_t	XOSC_SETTLE_MS	= 500;
+	/// Max. čas power-up po ENABLE podľa datasheetu (ms).
+	static const uint8_t	POWERUP_MS		= 110;
+
+	/// Pevný čas medzi čítaniami STC v blokujúcich funkciách (ms).
+	static const uint8_t	POLL_DELAY_MS	= 2;
+	/// Najdlhší čas tuningu jedného kanála (ms); seek má limit kanály pásma × STC_CHAN_MS.
+	static const uint8_t	STC_CHAN_MS		= 60;
+	/// Záložné čítanie STC v režime prerušení, ak nepríde hrana GPIO2 (ms).
+	static const uint16_t	INT_FALLBACK_MS	= 500;
+	/// Interval čítania RDSR bez prerušenia (ms).
+	static const uint8_t	RDS_POLL_MS		= 20;
+	/// Po prečítaní skupiny ostáva RDSR nastavený ešte až 40 ms – dovtedy sa nečíta.
+	static const uint8_t	RDS_HOLD_MS		= 40;
 
 	// Registers shadow
 	//------------------------------------------------------------------------------------------------------------
@@ -600,6 +882,10 @@ class Si4703
 	 * Umožňuje:
 	 *  - pristupovať k registrom ako k poľu word[16],
 	 *  - alebo cez pomenované union štruktúry (STATUSRSSI, SYSCONFIG atď.).
+	 *
+	 * Slúži ako cache: konfiguračné registre 0x02–0x07 vlastní ovládač a po
+	 * prvom načítaní sa z čipu už nečítajú; stavové registre (0x0A …) sa čítajú
+	 * len v rozsahu, ktorý volajúci potrebuje.
 	 */
 	union shadow_t
 	{
@@ -0,0 +1,186 @@
+#include "bandmap.h"
+
+/**
+ * @file
+ * @brief Implementácia bitovej mapy staníc v pásme.
+ */
+
+BandMap bandmap;
+
+/// Globálny objekt FM rádia (definovaný v Si4703.cpp).
+extern Si4703 radio;
+
+/// Čas v ms od štartu (implementovaný v main.cpp).
+extern unsigned long timer_millis();
+
+/// Počet bajtov bitovej mapy.
+#define BANDMAP_BYTES ((BANDMAP_MAX_CHANNELS + 7) / 8)
+
+/**
+ * @brief Poradie najnižšieho nastaveného bitu (b != 0).
+ */
+static uint8_t bandmap_lsb(uint8_t b)
+{
+    return __builtin_ctz(b);
+}
+
+/**
+ * @brief Poradie najvyššieho nastaveného bitu (b != 0).
+ */
+static uint8_t bandmap_msb(uint8_t b)
+{
+    return sizeof(int) * 8 - 1 - __builtin_clz(b);
+}
+
+/**
+ * @brief Nájde najnižší nastavený bit s indexom ≥ @p from.
+ *
+ * Nulové bajty sa preskočia celé, v prvom nenulovom bajte rozhodne
+ * poradie najnižšieho bitu – najviac 26 porovnaní pre celé pásmo.
+ *
+ * @return Index kanála alebo -1.
+ */
+static int16_t bandmap_find_up(const uint8_t *bits, uint16_t from)
+{
+    uint8_t byte = from >> 3;
+    if (byte >= BANDMAP_BYTES) return -1;
+
+    uint8_t b = bits[byte] & (uint8_t)(0xFF << (from & 7));
+    while (!b) {
+        if (++byte >= BANDMAP_BYTES) return -1;
+        b = bits[byte];
+    }
+    return (byte << 3) + bandmap_lsb(b);
+}
+
+/**
+ * @brief Nájde najvyšší nastavený bit s indexom ≤ @p from.
+ *
+ * @return Index kanála alebo -1.
+ */
+static int16_t bandmap_find_down(const uint8_t *bits, uint16_t from)
+{
+    uint8_t byte = from >> 3;
+    if (byte >= BANDMAP_BYTES) {
+        byte = BANDMAP_BYTES - 1;
+        from = BANDMAP_MAX_CHANNELS - 1;
+    }
+
+    uint8_t b = bits[byte] & (uint8_t)(0xFF >> (7 - (from & 7)));
+    while (!b) {
+        if (byte == 0) return -1;
+        b = bits[--byte];
+    }
+    return (byte << 3) + bandmap_msb(b);
+}
+
+/**
+ * @brief Konštruktor – mapa je prázdna a neplatná.
+ */
+BandMap::BandMap()
+{
+    for (uint8_t i = 0; i < BANDMAP_BYTES; i++) _bits[i] = 0;
+    _count    = 0;
+    _stations = 0;
+    _start    = 0;
+    _space    = 0;
+    _builtMs  = 0;
+}
+
+/**
+ * @brief Vytvorí mapu z tabuľky prechodu pásmom.
+ *
+ * @param scan Dokončený prechod pásmom.
+ */
+void BandMap::build(const BandScan &scan)
+{
+    uint16_t count = scan.getCount();
+
+    for (uint8_t i = 0; i < BANDMAP_BYTES; i++) _bits[i] = 0;
+    _stations = 0;
+    _count    = 0;
+    if (count == 0 || scan.getDone() < count) return;   // Zrušený prechod – mapa neplatí
+
+    uint8_t prev = 0;
+    uint8_t cur  = scan.getEntry(0) & BANDSCAN_RSSI_MASK;
+
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t entry = scan.getEntry(i);
+        uint8_t next  = (i + 1 < count) ? (scan.getEntry(i + 1) & BANDSCAN_RSSI_MASK) : 0;
+
+        // Stanica = platný kanál nad prahom, ktorý je lokálnym maximom
+        if (!(entry & BANDSCAN_AFCRL) && cur >= BANDMAP_RSSI_MIN && cur >= prev && cur > next) {
+            _bits[i >> 3] |= (1 << (i & 7));
+            _stations++;
+        }
+
+#if BANDMAP_STRENGTH
+        uint8_t nib = cur >> 2;                         // 0–63 dBμV → 0–15
+        if (i & 1) _strength[i >> 1] = (_strength[i >> 1] & 0x0F) | (nib << 4);
+        else       _strength[i >> 1] = nib;
+#endif
+
+        prev = cur;
+        cur  = next;
+    }
+
+    _count   = count;
+    _start   = scan.getFreq(0);
+    _space   = radio.getBandSpace();
+    _builtMs = timer_millis();
+}
+
+/**
+ * @brief Zistí, či sa dá mapa použiť namiesto seeku.
+ *
+ * @return true, ak mapa existuje, zodpovedá aktuálnemu pásmu rádia
+ *         a nie je staršia ako @ref BANDMAP_MAX_AGE_S.
+ */
+bool BandMap::isValid() const
+{
+    if (_count == 0) return false;
+    if (_start != radio.getBandStart() || _space != radio.getBandSpace()) return false;
+#if BANDMAP_MAX_AGE_S
+    if (timer_millis() - _builtMs > BANDMAP_MAX_AGE_S * 1000UL) return false;
+#endif
+    return true;
+}
+
+/**
+ * @brief Nájde najbližšiu stanicu v smere @p dir.
+ *
+ * @param freq Aktuálna frekvencia.
+ * @param dir  @ref Si4703::SEEK_UP alebo @ref Si4703::SEEK_DOWN.
+ * @return Frekvencia stanice alebo 0.
+ */
+int BandMap::next(int freq, uint8_t dir) const
+{
+    if (_count == 0 || _stations == 0) return 0;
+
+    int16_t cur = (freq - _start) / _space;
+    int16_t idx;
+
+    if (dir == Si4703::SEEK_UP) {
+        idx = (cur + 1 < (int16_t)_count) ? bandmap_find_up(_bits, cur + 1) : -1;
+        if (idx < 0) idx = bandmap_find_up(_bits, 0);               // Obehnutie pásma
+    } else {
+        idx = (cur > 0) ? bandmap_find_down(_bits, cur - 1) : -1;
+        if (idx < 0) idx = bandmap_find_down(_bits, _count - 1);    // Obehnutie pásma
+    }
+
+    return (idx < 0) ? 0 : _start + idx * _space;
+}
+
+#if BANDMAP_STRENGTH
+/**
+ * @brief Sila signálu kanála z poslednej mapy.
+ *
+ * @param idx Index kanála.
+ * @return RSSI / 4 (0–15).
+ */
+uint8_t BandMap::getStrength(uint16_t idx) const
+{
+    uint8_t b = _strength[idx >> 1];
+    return (idx & 1) ? (b >> 4) : (b & 0x0F);
+}
+#endif
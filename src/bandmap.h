@@ -0,0 +1,110 @@
+#ifndef BANDMAP_H
+#define BANDMAP_H
+
+#include <stdint.h>
+#include "bandscan.h"
+
+/**
+ * @file
+ * @brief Mapa obsadenosti pásma – 1 bit na kanál, hľadanie ďalšej stanice bez seeku.
+ *
+ * Mapa sa vytvorí z tabuľky prechodu pásmom (@ref BandScan). Ďalšia/predošlá
+ * stanica sa potom nájde v pamäti (preskočenie nulových bajtov a hľadanie
+ * najnižšieho/najvyššieho nastaveného bitu) a naladí sa jediným tuningom
+ * (~60 ms) namiesto hardvérového seeku (stovky ms až sekundy).
+ *
+ * Pamäť: pre 206 kanálov 26 bajtov; s @ref BANDMAP_STRENGTH ďalších
+ * 103 bajtov (4-bitová sila signálu pre každý kanál).
+ */
+
+/** @brief Kapacita mapy (počet kanálov) – zhodná s tabuľkou prechodu pásmom. */
+#define BANDMAP_MAX_CHANNELS BANDSCAN_MAX_CHANNELS
+
+/**
+ * @brief Minimálne RSSI (dBμV), od ktorého sa kanál považuje za stanicu.
+ *
+ * Predvolene rovnaké ako prah seeku ovládača Si4703 (SEEKTH = 24).
+ */
+#ifndef BANDMAP_RSSI_MIN
+# define BANDMAP_RSSI_MIN 24
+#endif
+
+/**
+ * @brief Doba platnosti mapy v sekundách (0 = neobmedzená).
+ *
+ * Po jej uplynutí sa ďalšia stanica opäť hľadá hardvérovým seekom.
+ */
+#ifndef BANDMAP_MAX_AGE_S
+# define BANDMAP_MAX_AGE_S 3600
+#endif
+
+/**
+ * @brief 1 = ukladať aj 4-bitovú silu signálu každého kanála (RSSI / 4).
+ */
+#ifndef BANDMAP_STRENGTH
+# define BANDMAP_STRENGTH 0
+#endif
+
+/**
+ * @class BandMap
+ * @brief Bitová mapa staníc v pásme.
+ */
+class BandMap {
+public:
+    /// Vytvorí prázdnu (neplatnú) mapu.
+    BandMap();
+
+    /**
+     * @brief Vytvorí mapu z dokončeného prechodu pásmom.
+     *
+     * Kanál je stanica, ak nemá AFC rail, jeho RSSI ≥ @ref BANDMAP_RSSI_MIN
+     * a je lokálnym maximom voči susedom (potlačí „rozliatie“ silnej
+     * stanice na susedné kanály).
+     *
+     * @param scan Prechod pásmom; neúplný prechod mapu zneplatní.
+     */
+    void build(const BandScan &scan);
+
+    /// Zneplatní mapu (napr. po zmene pásma).
+    void invalidate() { _count = 0; }
+
+    /// Zistí, či je mapa použiteľná (vytvorená, nie zastaraná, zodpovedá pásmu rádia).
+    bool isValid() const;
+
+    /**
+     * @brief Nájde najbližšiu stanicu v smere @p dir od frekvencie @p freq.
+     *
+     * Na konci pásma pokračuje od opačného okraja (ako seek s obehnutím).
+     *
+     * @param freq Aktuálna frekvencia (jednotky ovládača Si4703).
+     * @param dir  @ref Si4703::SEEK_UP alebo @ref Si4703::SEEK_DOWN.
+     * @return Frekvencia stanice alebo 0, ak mapa žiadnu stanicu neobsahuje.
+     */
+    int next(int freq, uint8_t dir) const;
+
+    /// Počet staníc v mape.
+    uint8_t getStations() const { return _stations; }
+    /// Zistí, či je kanál @p idx stanica.
+    bool isStation(uint16_t idx) const { return _bits[idx >> 3] & (1 << (idx & 7)); }
+
+#if BANDMAP_STRENGTH
+    /// Sila signálu kanála @p idx (0–15, RSSI / 4).
+    uint8_t getStrength(uint16_t idx) const;
+#endif
+
+private:
+    uint8_t       _bits[(BANDMAP_MAX_CHANNELS + 7) / 8];   ///< Bit i = kanál i je stanica.
+#if BANDMAP_STRENGTH
+    uint8_t       _strength[(BANDMAP_MAX_CHANNELS + 1) / 2]; ///< RSSI / 4 po 2 kanáloch v bajte.
+#endif
+    uint16_t      _count;           ///< Počet kanálov mapy (0 = neplatná).
+    uint8_t       _stations;        ///< Počet staníc.
+    int           _start;           ///< Frekvencia kanálu 0.
+    int           _space;           ///< Krok medzi kanálmi.
+    unsigned long _builtMs;         ///< Čas vytvorenia.
+};
+
+/// Globálna mapa pásma (definovaná v bandmap.cpp).
+extern BandMap bandmap;
+
+#endif
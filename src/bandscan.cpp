@@ -0,0 +1,132 @@
+#include "bandscan.h"
+
+/**
+ * @file
+ * @brief Implementácia rýchleho prechodu pásmom.
+ */
+
+BandScan bandscan;
+
+/// Globálny objekt FM rádia (definovaný v Si4703.cpp).
+extern Si4703 radio;
+
+/// Čas v ms od štartu (implementovaný v main.cpp).
+extern unsigned long timer_millis();
+
+/**
+ * @brief Súčet prenesených bajtov z počítadiel ovládača Si4703.
+ */
+static uint32_t bandscan_bus_bytes(void)
+{
+    const Si4703::busStats_t &st = radio.getBusStats();
+    return st.rxBytes + st.txBytes;
+}
+
+/**
+ * @brief Konštruktor – tabuľka je prázdna, prechod nebeží.
+ */
+BandScan::BandScan()
+{
+    _count        = 0;
+    _index        = 0;
+    _start        = 0;
+    _space        = 0;
+    _restoreFreq  = 0;
+    _restoreDmute = false;
+    _running      = false;
+    _startMs      = 0;
+    _durationMs   = 0;
+    _busStart     = 0;
+    _busBytes     = 0;
+}
+
+/**
+ * @brief Spustí prechod pásmom.
+ *
+ * Zapamätá si aktuálnu frekvenciu a mute, stlmí audio (aby preladovanie
+ * nebolo počuť) a naladí prvý kanál pásma.
+ */
+void BandScan::begin()
+{
+    if (_running) return;
+
+    _start = radio.getBandStart();
+    _space = radio.getBandSpace();
+
+    uint16_t channels = (radio.getBandEnd() - _start) / _space + 1;
+    _count = (channels > BANDSCAN_MAX_CHANNELS) ? BANDSCAN_MAX_CHANNELS : channels;
+    _index = 0;
+
+    _restoreFreq  = radio.getChannel();
+    _restoreDmute = radio.getMute();
+    radio.setMute(false);                   // DMUTE=0 – audio stlmené
+
+    _busStart = bandscan_bus_bytes();
+    _startMs  = timer_millis();
+    _running  = true;
+
+    radio.beginTune(_start);
+}
+
+/**
+ * @brief Pokračuje v prechode pásmom – jeden krok @ref Si4703::poll.
+ *
+ * Po dokončenom tuningu (STC) sa hneď z už prečítaného STATUSRSSI
+ * zapíše položka a spustí tuning ďalšieho kanála – RSSI je platné
+ * okamžite po STC, ďalšie čakanie nie je potrebné. Kým STC nepríde,
+ * funkcia sa hneď vráti, takže tlačidlá a enkóder sa obsluhujú aj
+ * počas prechodu.
+ *
+ * @return true, kým prechod beží.
+ */
+bool BandScan::poll()
+{
+    if (!_running) return false;
+
+    Si4703::tuneStatus_t st = radio.poll();
+
+    if (st == Si4703::TUNE_BUSY) return true;
+    if (st != Si4703::TUNE_DONE) {          // Zrušené zvonka alebo čip neodpovedá
+        finish();
+        return false;
+    }
+
+    uint8_t rssi  = radio.getLastRSSI();
+    uint8_t entry = (rssi > BANDSCAN_RSSI_MASK) ? BANDSCAN_RSSI_MASK : rssi;
+    if (radio.getLastST())    entry |= BANDSCAN_ST;
+    if (radio.getLastAFCRL()) entry |= BANDSCAN_AFCRL;
+    _table[_index++] = entry;
+
+    if (_index >= _count) {
+        finish();
+        return false;
+    }
+    radio.beginTune(getFreq(_index));
+    return true;
+}
+
+/**
+ * @brief Zruší prechod pásmom; tabuľka obsahuje len doteraz zmerané kanály.
+ */
+void BandScan::cancel()
+{
+    if (!_running) return;
+    radio.cancel();
+    finish();
+}
+
+/**
+ * @brief Uloží výsledky merania a vráti rádio do stavu pred prechodom.
+ *
+ * Pôvodná frekvencia sa naladí neblokujúco – dokončí ju @ref Si4703::poll
+ * v hlavnej slučke.
+ */
+void BandScan::finish()
+{
+    _running    = false;
+    _durationMs = timer_millis() - _startMs;
+    _busBytes   = bandscan_bus_bytes() - _busStart;
+
+    radio.setMute(_restoreDmute);
+    radio.beginTune(_restoreFreq);
+}
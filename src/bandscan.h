@@ -0,0 +1,114 @@
+#ifndef BANDSCAN_H
+#define BANDSCAN_H
+
+#include <stdint.h>
+#include "Si4703.h"
+
+/**
+ * @file
+ * @brief Rýchly prechod celým pásmom – tabuľka signálu pre každý kanál.
+ *
+ * Namiesto opakovaného hardvérového seeku sa každý kanál pásma
+ * (od @ref Si4703::getBandStart po @ref Si4703::getBandEnd po krokoch
+ * @ref Si4703::getBandSpace) len naladí a hneď po STC sa zapíše jeho
+ * RSSI a príznaky. Čaká sa teda len na samotný tuning (STC), nie na
+ * vyhodnotenie seeku.
+ *
+ * Trvanie prechodu je súčet časov tuningu – do STC čipu (datasheet:
+ * najviac 60 ms na kanál, teda najviac ~12 s pre 206 kanálov). Skutočný
+ * čas hlási hlavná slučka v riadku „SCAN … ms“.
+ *
+ * Každý kanál zaberá v tabuľke 1 bajt:
+ * - bity 0–5: RSSI v dBμV (nasýtené na 63),
+ * - bit 6:    stereo (ST),
+ * - bit 7:    AFC rail (AFCRL) – kanál je pravdepodobne neplatný.
+ *
+ * Pásmo US/EU so 100 kHz krokom = 206 kanálov = 206 bajtov.
+ */
+
+/**
+ * @brief Kapacita tabuľky (počet kanálov). Pri väčšom počte sa prejde len prvých N.
+ *
+ * 206 pokryje 87,5–108 MHz so 100 kHz krokom.
+ */
+#ifndef BANDSCAN_MAX_CHANNELS
+# define BANDSCAN_MAX_CHANNELS 206
+#endif
+
+/**
+ * @name Formát položky tabuľky
+ * @{
+ */
+#define BANDSCAN_RSSI_MASK  0x3F  /**< @brief RSSI v dBμV (0–63). */
+#define BANDSCAN_ST         0x40  /**< @brief Stereo príjem. */
+#define BANDSCAN_AFCRL      0x80  /**< @brief AFC rail – neplatný kanál. */
+/** @} */
+
+/**
+ * @class BandScan
+ * @brief Neblokujúci prechod pásmom nad globálnym objektom @c radio.
+ *
+ * Typické použitie:
+ * - @ref begin spustí prechod (audio sa stlmí),
+ * - v hlavnej slučke sa namiesto @ref Si4703::poll volá @ref poll,
+ * - po skončení sa rádio vráti na pôvodnú frekvenciu a tabuľka je
+ *   dostupná cez @ref getEntry.
+ */
+class BandScan {
+public:
+    /// Vytvorí prázdnu tabuľku.
+    BandScan();
+
+    /// Spustí prechod pásmom (bežiaci seek/tuning sa zruší).
+    void begin();
+
+    /**
+     * @brief Pokračuje v prechode (neblokuje – jeden krok tuningu).
+     *
+     * @return true, kým prechod beží; false po dokončení alebo zrušení.
+     */
+    bool poll();
+
+    /// Zruší prechod a vráti rádio na pôvodnú frekvenciu.
+    void cancel();
+
+    /// Zistí, či prechod práve beží.
+    bool isRunning() const { return _running; }
+    /// Frekvencia pred prechodom – na ňu sa rádio vráti po dokončení alebo zrušení.
+    int getRestoreFreq() const { return _restoreFreq; }
+
+    /// Počet kanálov v tabuľke.
+    uint16_t getCount() const { return _count; }
+    /// Počet už zmeraných kanálov (priebeh, po dokončení = @ref getCount).
+    uint16_t getDone() const { return _index; }
+    /// Položka tabuľky pre kanál @p idx (formát BANDSCAN_*).
+    uint8_t getEntry(uint16_t idx) const { return _table[idx]; }
+    /// Frekvencia kanálu @p idx v jednotkách ovládača Si4703.
+    int getFreq(uint16_t idx) const { return _start + (int)idx * _space; }
+
+    /// Trvanie posledného prechodu (ms).
+    unsigned long getDurationMs() const { return _durationMs; }
+    /// Počet bajtov prenesených po I2C počas posledného prechodu.
+    uint32_t getBusBytes() const { return _busBytes; }
+
+private:
+    void finish();
+
+    uint8_t       _table[BANDSCAN_MAX_CHANNELS];  ///< Položky kanálov.
+    uint16_t      _count;           ///< Počet kanálov v tabuľke.
+    uint16_t      _index;           ///< Práve merený kanál.
+    int           _start;           ///< Frekvencia kanálu 0.
+    int           _space;           ///< Krok medzi kanálmi.
+    int           _restoreFreq;     ///< Frekvencia pred prechodom.
+    bool          _restoreDmute;    ///< DMUTE pred prechodom.
+    bool          _running;         ///< Prechod beží.
+    unsigned long _startMs;         ///< Čas spustenia.
+    unsigned long _durationMs;      ///< Trvanie posledného prechodu.
+    uint32_t      _busStart;        ///< Stav počítadla I2C bajtov pri spustení.
+    uint32_t      _busBytes;        ///< I2C bajty posledného prechodu.
+};
+
+/// Globálny objekt prechodu pásmom (definovaný v bandscan.cpp).
+extern BandScan bandscan;
+
+#endif
@@ -1,18 +1,24 @@
 #include <stdbool.h>
 #include "button_function.h"
 #include "oled.h"
+#include "screen.h"
+#include <stdio.h>
+#include <avr/pgmspace.h>
 
 /// @file
 /// @brief Implementácia obsluhy UI udalostí (tlačidlá + enkóder) pre FM rádio.
 ///
 /// Tento modul:
-/// - drží interný stav rádia (zapnuté/vypnuté, obľúbená stanica, režim enkódera),
+/// - drží interný stav rádia (zapnuté/vypnuté, posledná predvoľba, režim enkódera),
 /// - mapuje udalosti z UI (`ui_event_t`) na konkrétne akcie nad objektom `Si4703`,
 /// - pri niektorých akciách aktualizuje OLED (napr. uloženie obľúbenej stanice).
 
 // !!! Uprav podľa reálneho názvu hlavičky s funkciami rádia
 // Na screenshote boli funkcie ako incChannel(), seekUp(), incVolume()...
 #include "Si4703.h"   // alebo napr. "radio.h"
+#include "bandscan.h"
+#include "bandmap.h"
+#include "presets.h"
 
 /// @brief Globálny objekt FM rádia (deklarovaný inde).
 extern Si4703 radio;
@@ -27,9 +33,8 @@ extern int current_freq_khz;
 /// @brief Interný stav – aktuálny mód enkódera (hlasitosť alebo ladenie).
 static radio_mode_t s_mode = RADIO_MODE_VOLUME;
 
-/// @brief Uložená „obľúbená“ frekvencia v kHz (0 = zatiaľ nenastavená).
-static int s_favorite_freq = 0;
-// static bool s_has_favorite = false;  // prípadný dodatočný príznak
+/// @brief Posledná naladená alebo uložená predvoľba (banka v EEPROM, @ref presets.h).
+static uint8_t s_preset = PRESET_SLOTS - 1;
 
 /// @brief Interný stav – či je rádio zapnuté (true) alebo vypnuté (false).
 static bool s_radio_on = true;   // po štarte v setup() rádio zapneme
@@ -82,22 +87,42 @@ bool radio_ui_is_on(void)
 
 /// @brief Pomocná funkcia na prepnutie napájania rádia (ON/OFF).
 ///
-/// Ak je rádio zapnuté, zavolá `radio.powerDown()` a nastaví @ref s_radio_on na false.
-/// Ak je vypnuté, zavolá `radio.powerUp()` a nastaví @ref s_radio_on na true.
+/// Ak je rádio zapnuté, zavolá `radio.standby()` a nastaví @ref s_radio_on na false.
+/// Ak je vypnuté, zavolá `radio.resume()` a nastaví @ref s_radio_on na true –
+/// frekvencia, hlasitosť a mute sa obnovia zo snímky pred vypnutím.
 static void radio_toggle_power(void)
 {
     if (s_radio_on) {
-        // Rádio je zapnuté -> vypneme
-        radio.powerDown();   // funkcia z knižnice Si4703 
+        // Rádio je zapnuté -> pohotovostný režim
+        if (bandscan.isRunning()) bandscan.cancel();
+        radio.standby();
         s_radio_on = false;
     } else {
-        // Rádio je vypnuté -> znovu zapneme
-        radio.powerUp();     // alebo radio.start(), ak chceš komplet re-init
+        // Rádio je vypnuté -> obnova (pri resete čipu aj reinicializácia)
+        radio.resume();
         s_radio_on = true;
     }
 }
 
 
+/// @brief Prejde na ďalšiu stanicu v smere @p dir.
+///
+/// Ak je k dispozícii platná mapa pásma (@ref bandmap), stanica sa nájde
+/// v pamäti a naladí jediným tuningom. Inak (žiadny alebo zastaraný prechod
+/// pásmom) sa spustí hardvérový seek.
+static void radio_next_station(uint8_t dir)
+{
+    if (bandmap.isValid()) {
+        int freq = bandmap.next(radio.getChannel(), dir);
+        if (freq != 0) {
+            radio.beginTune(freq);
+            return;
+        }
+    }
+    radio.beginSeek(dir);
+}
+
+
 /* --------------------------------------------------------------------------
  * Hlavná funkcia – spracuje jednu udalosť z UI
  * Volaj ju z main() vždy, keď ti input vrstva vráti nejaký ui_event_t.
@@ -107,8 +132,10 @@ static void radio_toggle_power(void)
  * @brief Spracuje jednu udalosť z používateľského rozhrania.
  *
  * Podľa hodnoty @p ev vykoná:
- * - krok seeku hore/dole (ľavé/pravé tlačidlo),
- * - naladenie/uloženie obľúbenej frekvencie (horné tlačidlo),
+ * - prechod na ďalšiu/predošlú stanicu podľa mapy pásma, bez mapy
+ *   seek hore/dole; druhé stlačenie ho zruší (ľavé/pravé tlačidlo),
+ * - prechod celým pásmom (dlhé stlačenie pravého tlačidla),
+ * - naladenie ďalšej predvoľby / uloženie stanice do predvoľby (horné tlačidlo),
  * - prepnutie mute, resp. zapnutie/vypnutie rádia (dolné tlačidlo),
  * - zmenu hlasitosti alebo frekvencie (otáčanie enkódera),
  * - prepnutie režimu enkódera VOLUME/TUNE (klik na enkóder).
@@ -126,39 +153,88 @@ void radio_ui_handle_event(ui_event_t ev)
 
     case UI_BTN_LEFT:
     {
-        // Preladenie o jeden kanál nižšie (seek smerom nadol)
-        radio.seekDown();
+        // Čip v standby neladí – seek by sa nedočkal STC
+        if (!s_radio_on) break;
+        // Stlačenie počas prechodu pásmom ho zruší
+        if (bandscan.isRunning()) bandscan.cancel();
+        // Druhé stlačenie počas seeku ho zruší
+        else if (radio.isBusy()) radio.cancel();
+        // Inak predošlá stanica z mapy alebo seek nadol (dokončí ho radio.poll() v hlavnej slučke)
+        else radio_next_station(Si4703::SEEK_DOWN);
         break;
     }
 
     case UI_BTN_RIGHT:
     {
-        // Preladenie o jeden kanál vyššie (seek smerom nahor)
-        radio.seekUp();
+        // Čip v standby neladí – seek by sa nedočkal STC
+        if (!s_radio_on) break;
+        // Stlačenie počas prechodu pásmom ho zruší
+        if (bandscan.isRunning()) bandscan.cancel();
+        // Druhé stlačenie počas seeku ho zruší
+        else if (radio.isBusy()) radio.cancel();
+        // Inak ďalšia stanica z mapy alebo seek nahor (dokončí ho radio.poll() v hlavnej slučke)
+        else radio_next_station(Si4703::SEEK_UP);
+        break;
+    }
+
+    // ───────── PRAVÝ BUTTON – dlhý stisk = prechod celým pásmom ─────────
+    case UI_BTN_RIGHT_LONG:
+    {
+        // Pri vypnutom rádiu nie je čo merať
+        if (s_radio_on && !bandscan.isRunning()) bandscan.begin();
         break;
     }
 
-    // ───────── HORNÝ BUTTON – krátky stisk = naladiť obľúbenú ─────────
+    // ───────── HORNÝ BUTTON – krátky stisk = naladiť ďalšiu predvoľbu ─────────
     case UI_BTN_UP_SHORT:
     {
-        if (s_favorite_freq != 0) {
-            // Ak máme uloženú obľúbenú, naladíme ju
-            radio.setChannel(s_favorite_freq);
+        // Predvoľba sa naladí až po zapnutí (čip v standby neladí)
+        if (!s_radio_on) break;
+        // Prechod pásmom by výsledok tuningu zapísal ako ďalší kanál
+        if (bandscan.isRunning()) bandscan.cancel();
+
+        int8_t slot = preset_next(s_preset);
+        if (slot >= 0) {
+            // Ďalšia obsadená predvoľba (cyklicky), naladenie bez čakania na STC
+            s_preset = slot;
+            radio.beginTune(preset_get(slot));
         }
-        // Ak obľúbená ešte nie je, správanie je aktuálne „nič nerobiť“
-        // (alternatíva: možnosť vrátiť pôvodné správanie, napr. seekUp()).
+        // Ak nie je uložená žiadna predvoľba, správanie je „nič nerobiť“
         break;
     }
 
-    // ───────── HORNÝ BUTTON – dlhý stisk = uložiť obľúbenú ─────────
+    // ───────── HORNÝ BUTTON – dlhý stisk = uložiť stanicu do predvoľby ─────────
     case UI_BTN_UP_LONG: 
     {
-        int current = radio.getChannel(); // aktuálna frekvencia v kHz
-        s_favorite_freq = current;        // uložíme ako obľúbenú
-        // s_has_favorite = true; // ak by sa používal samostatný flag
+        // Čip v standby neladí – uložila by sa neplatná frekvencia
+        if (!s_radio_on) break;
+
+        int current;
+        if (bandscan.isRunning()) {
+            // Prechod pásmom sa zruší a uloží sa stanica, na ktorú sa rádio vracia
+            bandscan.cancel();
+            current = bandscan.getRestoreFreq();
+        } else if (radio.isBusy()) {
+            // Počas seeku/tuningu frekvencia nie je ustálená – stlačenie sa ignoruje
+            break;
+        } else {
+            current = radio.getChannel(); // aktuálna frekvencia v kHz
+        }
 
-        // Informácia pre používateľa – zobrazí sa na spodnom riadku OLED
-        oled_show_favorite_saved_bottom(current);
+        // Stanica už uložená → len ju označíme; inak prvá voľná predvoľba,
+        // pri plnej banke sa prepíše predvoľba za naposledy použitou
+        int8_t slot = preset_find(current);
+        if (slot < 0) slot = preset_find(0);
+        if (slot < 0) slot = (s_preset + 1) % PRESET_SLOTS;
+
+        preset_save(slot, current);       // EEPROM – prežije reset
+        s_preset = slot;
+
+        // Informácia pre používateľa – hláška na spodnom riadku OLED,
+        // zmizne sama po SCREEN_TOAST_MS (slučka medzitým beží ďalej)
+        char line[SCREEN_TOAST_LEN + 1];
+        snprintf_P(line, sizeof(line), PSTR("FAVORITE %3d.%1dMHz"), current / 100, (current % 100) / 10);
+        screen_toast(line, SCREEN_TOAST_MS);
         break;
     }
 
@@ -188,11 +264,16 @@ void radio_ui_handle_event(ui_event_t ev)
 
     case UI_ENC_STEP_CW:
     {
+        // Pri vypnutom rádiu enkóder nič nemení
+        if (!s_radio_on) break;
+
         if (s_mode == RADIO_MODE_VOLUME) {
             // Režim hlasitosti – krokovo zvyšuj volume
             radio.incVolume();
         } else {
             // Režim manuálneho ladenia – krok nahor vo frekvencii
+            // (prechod pásmom by výsledok zapísal ako ďalší kanál)
+            if (bandscan.isRunning()) bandscan.cancel();
             radio.incChannel();
         }
         break;
@@ -200,11 +281,15 @@ void radio_ui_handle_event(ui_event_t ev)
 
     case UI_ENC_STEP_CCW:
     {
+        // Pri vypnutom rádiu enkóder nič nemení
+        if (!s_radio_on) break;
+
         if (s_mode == RADIO_MODE_VOLUME) {
             // Režim hlasitosti – krokovo znižuj volume
             radio.decVolume();
         } else {
             // Režim manuálneho ladenia – krok nadol vo frekvencii
+            if (bandscan.isRunning()) bandscan.cancel();
             radio.decChannel();
         }
         break;
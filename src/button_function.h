@@ -34,6 +34,7 @@ typedef enum {
 
     UI_BTN_LEFT,           /**< Krátke stlačenie ľavého tlačidla. */
     UI_BTN_RIGHT,          /**< Krátke stlačenie pravého tlačidla. */
+    UI_BTN_RIGHT_LONG,     /**< Dlhé stlačenie pravého tlačidla. */
     UI_BTN_UP_SHORT,       /**< Krátke stlačenie horného tlačidla. */
     UI_BTN_UP_LONG,        /**< Dlhé stlačenie horného tlačidla. */
     UI_BTN_DOWN_SHORT,     /**< Krátke stlačenie dolného tlačidla. */
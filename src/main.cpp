@@ -5,6 +5,7 @@
 #include <avr/io.h>
 #include <avr/interrupt.h>
 #include <util/delay.h>
+#include <stdlib.h>
 
 #include "timer.h"
 #include "gpio.h"
@@ -12,12 +13,51 @@
 #include "RotaryEncoder.h"
 #include "button_function.h"
 #include "oled.h"
+#if OLED_BUS == OLED_BUS_SOFT
+#include "swi2c.h"
+#endif
 #include "Si4703.h"
+#include "bandscan.h"
+#include "bandmap.h"
+#include "presets.h"
+#include "screen.h"
 
 extern "C" {
     #include "uart.h"
 }
 
+/**
+ * @brief 1 = po štarte zmerať I2C pri 100 kHz a 400 kHz a vypísať cez UART (@ref twi_bench).
+ */
+#ifndef TWI_BENCH
+# define TWI_BENCH 0
+#endif
+
+/**
+ * @brief 1 = v hlavnej slučke vypisovať cez UART nové maximá (snímka displeja, iterácia slučky, RDS fronta, čakanie v TWI).
+ */
+#ifndef LOOP_STATS
+# define LOOP_STATS 0
+#endif
+
+/**
+ * @brief Dĺžka snímky plánovača TWI v ms – perióda @ref twi_sched_frame (rozpočet @ref OLED_BUS_BUDGET).
+ */
+#ifndef TWI_FRAME_MS
+# define TWI_FRAME_MS 20
+#endif
+
+/**
+ * @brief Rýchlosť UART – pri @ref TWI_TRACE 250 kbaud (presná pri 16 MHz), aby binárny výpis stíhal.
+ */
+#ifndef UART_BAUD
+# if TWI_TRACE
+#  define UART_BAUD 250000UL
+# else
+#  define UART_BAUD 9600
+# endif
+#endif
+
 /**
  * @file main.cpp
  * @brief Hlavný program FM rádia s enkóderom, tlačidlami a OLED displejom.
@@ -46,10 +86,17 @@ volatile unsigned long millis_counter = 0;
  * @brief Obsluha prerušení overflowu časovača 0.
  *
  * ISR je vyvolaná pri každom pretečení Timer/Counter0
- * (TIMER0_OVF_vect) a inkrementuje @ref millis_counter.
+ * (TIMER0_OVF_vect), inkrementuje @ref millis_counter a každých
+ * @ref TWI_FRAME_MS začne novú snímku plánovača TWI (@ref twi_sched_frame).
  */
 ISR(TIMER0_OVF_vect) {
+    static uint8_t frame_ms = 0;
+
     millis_counter++;
+    if (++frame_ms >= TWI_FRAME_MS) {
+        frame_ms = 0;
+        twi_sched_frame();
+    }
 }
 
 /**
@@ -72,6 +119,35 @@ unsigned long timer_millis() {
     return m;
 }
 
+/**
+ * @brief Čas od štartu v tikoch Timer0 (4 µs).
+ *
+ * Spojí @ref millis_counter (pretečenia) s TCNT0; pretečenie, ktoré ISR
+ * ešte neobslúžila (volanie z iného prerušenia), sa pripočíta podľa TOV0.
+ *
+ * @return Čas od štartu v tikoch po 4 µs.
+ */
+uint32_t timer_ticks(void)
+{
+    uint8_t  old = SREG;
+    cli();
+    uint32_t m = millis_counter;
+    uint8_t  t = TCNT0;
+    if ((TIFR0 & (1<<TOV0)) && t < 255) m++;
+    SREG = old;
+    return (m << 8) | t;
+}
+
+#if TWI_TRACE
+/**
+ * @brief Časová značka pre tracer I2C (@ref TWI_TRACE) – @ref timer_ticks.
+ */
+extern "C" uint32_t twi_trace_clock(void)
+{
+    return timer_ticks();
+}
+#endif
+
 // ------------------- Buttons -------------------
 
 /**
@@ -114,42 +190,179 @@ RotaryEncoder encoder(
  */
 extern Si4703 radio;
 
+#if TWI_BENCH
+/**
+ * @brief Vypíše cez UART „<label><hodnota><unit>“ (@p label a @p unit vo flash, PSTR).
+ */
+static void twi_bench_put(const char *label, unsigned long value, const char *unit)
+{
+    char buf[12];
+
+    uart_puts_p(label);
+    uart_puts(ultoa(value, buf, 10));
+    uart_puts_p(unit);
+}
+
+/**
+ * @brief Čas jednej celej obrazovky OLED v ms (priemer zo 4 × @ref oled_clear).
+ */
+static unsigned long twi_bench_frame(void)
+{
+    unsigned long t0 = timer_millis();
+    for (uint8_t i = 0; i < 4; i++) oled_clear();
+    return (timer_millis() - t0) / 4;
+}
+
+/**
+ * @brief Čas jedného čítania 8 registrov Si4703 v µs (priemer zo 100 čítaní).
+ */
+static unsigned long twi_bench_shadow(void)
+{
+    unsigned long t0 = timer_millis();
+    for (uint8_t i = 0; i < 100; i++) radio.readRegisters(8);
+    return (timer_millis() - t0) * 10;
+}
+
+/**
+ * @brief Čakanie tunera za prevádzkou displeja v µs (priemer z 10 meraní).
+ *
+ * Čas čítania 8 registrov Si4703 hneď po @ref oled_clear. Pri
+ * @ref OLED_BUS_TWI sú vtedy vo fronte TWI ešte posledné stránky
+ * obrazovky a čítanie (rovnako ako čítanie RDS skupiny z prerušenia)
+ * čaká za nimi; pri @ref OLED_BUS_SOFT je zbernica tunera voľná.
+ */
+static unsigned long twi_bench_wait(void)
+{
+    uint32_t sum = 0;
+
+    for (uint8_t i = 0; i < 10; i++) {
+        oled_clear();
+        uint32_t t0 = timer_ticks();
+        radio.readRegisters(8);
+        sum += timer_ticks() - t0;
+    }
+    return sum * 4 / 10;                                      // tik = 4 µs
+}
+
+/**
+ * @brief Bajty na zbernici za jedno prekreslenie hlavnej obrazovky (@ref oled_show_radio_screen).
+ *
+ * Počíta adresu, riadiaci bajt a dáta všetkých transakcií displeja
+ * (@ref oled_get_bus_stats) pri 107.0 MHz, hlasitosti 10 a RSSI @p rssi.
+ */
+static unsigned long twi_bench_screen(int rssi)
+{
+    uint32_t b0, b1;
+    uint16_t x;
+
+    oled_get_bus_stats(&b0, &x);
+    oled_show_radio_screen(10700, 10, rssi, false);
+    oled_get_bus_stats(&b1, &x);
+    return b1 - b0;
+}
+
+/**
+ * @brief Porovná rýchlosti I2C zbernice pre OLED a prenosy Si4703.
+ *
+ * Pre 100 kHz a 400 kHz zmeria čas celej obrazovky OLED (@ref oled_clear,
+ * 8 stránok × 128 bajtov), jedného čítania 8 registrov Si4703 (16 bajtov)
+ * a čakania tunera za displejom (@ref twi_bench_wait) a vypíše napr.
+ * „TWI 400 kHz: frame 30 ms, shadow 480 us, wait 3900 us“.
+ * - Pri @ref OLED_BUS_SOFT sa obrazovka meria raz („SWI2C 400 kHz: frame …“).
+ * - Ak tuner používa 3-wire rozhranie (@ref SI4703_BUS), čítanie sa meria
+ *   raz („3-WIRE spi: shadow 140 us“).
+ * - Prenos hlavnej obrazovky sa vypíše v bajtoch zbernice po vymazaní,
+ *   bez zmeny a pri zmene RSSI o jednu číslicu (@ref twi_bench_screen),
+ *   napr. „OLED radio screen: full 234 B, idle 0 B, rssi 15 B“.
+ *
+ * Nakoniec vráti rýchlosti @ref OLED_SCL_HZ a @ref SI4703_SCL_HZ.
+ */
+static void twi_bench(void)
+{
+    static const uint32_t speeds[] = { 100000UL, 400000UL };
+    bool twoWire = (radio.getBusMode() == BUS_2WIRE);
+
+    for (uint8_t s = 0; s < 2; s++) {
+        oled_set_speed(speeds[s]);
+        radio.setBusSpeed(speeds[s]);
+
+        twi_bench_put(PSTR("TWI "), speeds[s] / 1000, PSTR(" kHz:"));
+#if OLED_BUS == OLED_BUS_TWI
+        twi_bench_put(PSTR(" frame "), twi_bench_frame(), PSTR(" ms,"));
+#endif
+        if (twoWire)
+            twi_bench_put(PSTR(" shadow "), twi_bench_shadow(), PSTR(" us,"));
+        twi_bench_put(PSTR(" wait "), twi_bench_wait(), PSTR(" us\r\n"));
+    }
+
+#if OLED_BUS == OLED_BUS_SOFT
+    twi_bench_put(PSTR("SWI2C "), SWI2C_HZ / 1000, PSTR(" kHz:"));
+    twi_bench_put(PSTR(" frame "), twi_bench_frame(), PSTR(" ms\r\n"));
+#endif
+    if (!twoWire)
+        twi_bench_put(radio.getBusMode() == BUS_3WIRE_SPI ? PSTR("3-WIRE spi: shadow ") : PSTR("3-WIRE gpio: shadow "),
+                      twi_bench_shadow(), PSTR(" us\r\n"));
+
+    oled_clear();
+    twi_bench_put(PSTR("OLED radio screen: full "), twi_bench_screen(25), PSTR(" B,"));
+    twi_bench_put(PSTR(" idle "), twi_bench_screen(25), PSTR(" B,"));
+    twi_bench_put(PSTR(" rssi "), twi_bench_screen(26), PSTR(" B\r\n"));
+
+    oled_set_speed(OLED_SCL_HZ);
+    radio.setBusSpeed(SI4703_SCL_HZ);
+}
+#endif
+
 /**
  * @brief Hlavná funkcia programu.
  *
  * Postup:
- * - inicializácia UART @ref uart_init pre debug (9600 baud),
- * - inicializácia OLED displeja @ref oled_init,
- * - nastavenie časovača 0 na overflow každú 1 ms a povolenie prerušení,
- * - inicializácia tlačidiel @ref Button::begin,
- * - inicializácia enkódera @ref RotaryEncoder::begin,
- * - globálne povolenie prerušení @ref sei,
- * - inicializácia a nastavenie tunera Si4703:
- *   - @ref Si4703::start,
- *   - @ref Si4703::setChannel na 107.00 MHz,
+ * - inicializácia UART @ref uart_init pre debug (@ref UART_BAUD),
+ * - nastavenie časovača 0 na overflow každú 1 ms a globálne povolenie prerušení,
+ * - spustenie štartu tunera Si4703 @ref Si4703::beginStart (reset, XOSCEN),
+ * - počas ustálenia oscilátora (~500 ms):
+ *   - inicializácia OLED displeja @ref oled_init a úvodná obrazovka
+ *     @ref oled_show_splash,
+ *   - inicializácia tlačidiel @ref Button::begin,
+ *   - inicializácia enkódera @ref RotaryEncoder::begin,
+ *   - načítanie predvolieb staníc z EEPROM @ref preset_init,
+ * - dokončenie štartu tunera @ref Si4703::pollStart a nastavenie:
  *   - @ref Si4703::setVolume na hodnotu 10,
- *   - @ref Si4703::powerDown a následne @ref Si4703::powerUp,
+ *   - @ref Si4703::setChannel na 107.00 MHz,
+ * - výpis doby štartu cez UART („BOOT n ms“),
+ * - pri @ref TWI_BENCH meranie I2C pri 100/400 kHz (@ref twi_bench),
  * - nekonečná slučka:
+ *   - jeden krok asynchrónneho seeku/tuningu @ref Si4703::poll
+ *     (počas prechodu pásmom @ref BandScan::poll, výsledok cez UART
+ *     a do mapy staníc @ref BandMap::build),
  *   - čítanie udalostí z tlačidiel a enkódera,
  *   - mapovanie na UI udalosti cez @ref radio_ui_handle_event,
  *   - debug výpis smeru enkódera cez UART,
- *   - čítanie aktuálneho stavu rádia (frekvencia, RSSI, hlasitosť, mute),
- *   - prekreslenie hlavnej obrazovky rádia na OLED
- *     pomocou @ref oled_show_radio_screen.
+ *   - snímka displeja @ref screen_poll – najviac @ref SCREEN_FPS za sekundu
+ *     prečíta stav rádia (frekvencia, RSSI, hlasitosť, mute, režim, zapnutie)
+ *     a prekreslí len zmenené prvky hlavnej obrazovky,
+ *   - pri @ref LOOP_STATS výpis nových maxím cez UART (čas a bajty
+ *     snímky, doba iterácie slučky, RDS fronta, čakanie tunera v TWI),
+ *   - pri @ref TWI_TRACE binárny výpis záznamov I2C (@ref twi_trace_dump).
  *
  * @return V praxi nikdy nevracia, formálne 0.
  */
 int main(void)
 {
     // UART
-    uart_init(UART_BAUD_SELECT(9600, F_CPU));
-
-    // OLED
-    oled_init();
+    uart_init(UART_BAUD_SELECT(UART_BAUD, F_CPU));
 
     // Timer
     tim0_ovf_1ms();
     tim0_ovf_enable();
+    sei();
+
+    // RADIO INIT – oscilátor tunera sa ustáľuje, kým sa inicializuje zvyšok
+    radio.beginStart();
+
+    // OLED
+    oled_init();
+    oled_show_splash();
 
     // Buttons init
     UpButton.begin();
@@ -160,17 +373,72 @@ int main(void)
     // Encoder init
     encoder.begin();
 
-    sei();
+    // Predvoľby staníc z EEPROM
+    preset_init();
 
-    // RADIO INIT
-    radio.start();
-    radio.setChannel(10700);
+    // Dokončenie štartu tunera (ENABLE, konfigurácia)
+    while (!radio.pollStart())
+        ;
     radio.setVolume(10);
-    radio.powerDown();
-    radio.powerUp();
+    radio.setChannel(10700);
+
+    // Hlavná obrazovka – prvá snímka ju vykreslí celú
+    screen_init();
+
+    {
+        char buf[12];
+        uart_puts_P("BOOT ");
+        uart_puts(ultoa(timer_millis(), buf, 10));
+        uart_puts_P(" ms\r\n");
+    }
+#if TWI_BENCH
+    twi_bench();
+#endif
+
+#if LOOP_STATS
+    // Najdlhšia nameraná doba jednej iterácie hlavnej slučky (ms)
+    unsigned long loop_max_ms = 0;
+    // Posledné vypísané zaplnenie a pretečenia RDS fronty
+    uint8_t  rds_hw  = 0;
+    uint16_t rds_ovf = 0;
+    // Posledné vypísané najdlhšie čakanie tunera vo fronte TWI (bajty zbernice)
+    uint16_t twi_wait_hi = 0;
+    // Posledná vypísaná najdlhšia snímka displeja (µs) a najväčší prenos snímky (B)
+    uint16_t frame_us = 0;
+    uint16_t frame_b  = 0;
+#endif
 
     while (1)
     {
+#if LOOP_STATS
+        unsigned long loop_start = timer_millis();
+#endif
+
+        // ---------------- Tuner (seek/tune/scan) ----------------
+        // Jeden krok bežiaceho seeku/tuningu – nikdy neblokuje slučku;
+        // počas prechodu pásmom tuner riadi bandscan
+        if (bandscan.isRunning()) {
+            if (!bandscan.poll()) {
+                char buf[12];
+                bandmap.build(bandscan);        // LEFT/RIGHT odteraz bez seeku
+                uart_puts_P("SCAN ");
+                uart_puts(utoa(bandscan.getDone(), buf, 10));
+                uart_puts_P(" ch ");
+                uart_puts(ultoa(bandscan.getDurationMs(), buf, 10));
+                uart_puts_P(" ms ");
+                uart_puts(ultoa(bandscan.getBusBytes(), buf, 10));
+                uart_puts_P(" B, ");
+                uart_puts(utoa(bandmap.getStations(), buf, 10));
+                uart_puts_P(" stations\r\n");
+            }
+        } else {
+            radio.poll();
+        }
+
+        // ---------------- RDS ----------------
+        // Nová RDS skupina (ak je) – PS/RadioText/čas v radio.getRDS()
+        radio.readRDS();
+
         // ---------------- Button UP ----------------
         ButtonEvent upEv = UpButton.checkEvent();
         if (upEv == BTN_EVENT_SHORT) radio_ui_handle_event(UI_BTN_UP_SHORT);
@@ -186,8 +454,9 @@ int main(void)
             radio_ui_handle_event(UI_BTN_LEFT);
 
         // ---------------- Button RIGHT ----------------
-        if (RightButton.checkEvent() == BTN_EVENT_SHORT)
-            radio_ui_handle_event(UI_BTN_RIGHT);
+        ButtonEvent rtEv = RightButton.checkEvent();
+        if (rtEv == BTN_EVENT_SHORT) radio_ui_handle_event(UI_BTN_RIGHT);
+        else if (rtEv == BTN_EVENT_LONG) radio_ui_handle_event(UI_BTN_RIGHT_LONG);
 
         // ---------------- Encoder ----------------
         EncoderEvent ev = encoder.checkEvent();
@@ -197,17 +466,17 @@ int main(void)
         {
             case EVENT_CW:
                 radio_ui_handle_event(UI_ENC_STEP_CW);
-                uart_puts("CW\r\n");
+                uart_puts_P("CW\r\n");
                 break;
 
             case EVENT_CCW:
                 radio_ui_handle_event(UI_ENC_STEP_CCW);
-                uart_puts("CCW\r\n");
+                uart_puts_P("CCW\r\n");
                 break;
 
             case EVENT_BUTTON:
                 radio_ui_handle_event(UI_ENC_CLICK);
-                uart_puts("CLICK\r\n");
+                uart_puts_P("CLICK\r\n");
                 break;
 
             default:
@@ -215,20 +484,86 @@ int main(void)
         }
 
         // ---------------- OLED UPDATE ----------------
-                
-        int freq  = radio.getChannel();
-        int rssi  = radio.getRSSI();
-        int vol   = radio.getVolume();
-        bool muted = radio.getMute();
-
-        // ak je rádiový modul vypnutý, zobrazíme „power off“ hlášku
-        if (!radio_ui_is_on()) {
-            oled_show_power_off();
-        } else {
-            // inak štandardná obrazovka (mute alebo normál)
-            oled_show_radio_screen(freq, vol, rssi, !muted);
+        // Najviac SCREEN_FPS snímok za sekundu, prekreslia sa len zmenené
+        // prvky (pri vypnutom rádiu „power off“ hlavička, tuner sa nečíta)
+        screen_poll();
+
+#if LOOP_STATS
+        // Pri novom maxime času alebo prenosu snímky vypíšeme štatistiku
+        screen_stats_t scr_st;
+        screen_get_stats(&scr_st);
+        if (scr_st.time_max > frame_us || scr_st.bytes_max > frame_b) {
+            char buf[12];
+            frame_us = scr_st.time_max;
+            frame_b  = scr_st.bytes_max;
+            uart_puts_P("FRAME max ");
+            uart_puts(utoa(frame_us, buf, 10));
+            uart_puts_P(" us, ");
+            uart_puts(utoa(frame_b, buf, 10));
+            uart_puts_P(" B, last ");
+            uart_puts(utoa(scr_st.bytes_last, buf, 10));
+            uart_puts_P(" B, skipped ");
+            uart_puts(utoa(scr_st.skipped, buf, 10));
+            uart_puts_P("\r\n");
+        }
+
+        // ---------------- LOOP LATENCY ----------------
+        // Pri novom maxime vypíšeme dobu iterácie cez UART
+        unsigned long loop_ms = timer_millis() - loop_start;
+        if (loop_ms > loop_max_ms) {
+            char buf[12];
+            loop_max_ms = loop_ms;
+            uart_puts_P("LOOP max ");
+            uart_puts(ultoa(loop_max_ms, buf, 10));
+            uart_puts_P(" ms\r\n");
+        }
+
+        // ---------------- RDS FIFO ----------------
+        // Pri novom maxime zaplnenia alebo pretečení vypíšeme stav fronty;
+        // „defer“ = skupiny, ktorých čítanie čakalo vo fronte TWI za inou
+        // prevádzkou (pri OLED_BUS_SOFT len za tunerom samotným)
+        Si4703::rdsFifoStats_t rds_st;
+        radio.getRdsFifoStats(&rds_st);
+        if (rds_st.highWater > rds_hw || rds_st.overflows != rds_ovf) {
+            char buf[8];
+            rds_hw  = rds_st.highWater;
+            rds_ovf = rds_st.overflows;
+            uart_puts_P("RDS fifo max ");
+            uart_puts(utoa(rds_hw, buf, 10));
+            uart_puts_P(" ovf ");
+            uart_puts(utoa(rds_ovf, buf, 10));
+            uart_puts_P(" defer ");
+            uart_puts(utoa(rds_st.deferred, buf, 10));
+            uart_putc('/');
+            uart_puts(utoa(rds_st.groups, buf, 10));
+            uart_puts_P("\r\n");
         }
 
+        // ---------------- TWI SCHEDULER ----------------
+        // Pri novom maxime čakania tunera vypíšeme čakanie oboch tried
+        // v bajtoch zbernice – tuner má čakať najviac jeden úsek displeja
+        // (TWI_SCHED_CHUNK + adresa a riadiaci bajt)
+        twi_sched_stats_t hi, lo;
+        twi_sched_get_stats(TWI_PRIO_HIGH, &hi);
+        if (hi.wait_max > twi_wait_hi) {
+            char buf[8];
+            twi_sched_get_stats(TWI_PRIO_LOW, &lo);
+            twi_wait_hi = hi.wait_max;
+            uart_puts_P("TWI wait hi max ");
+            uart_puts(utoa(hi.wait_max, buf, 10));
+            uart_puts_P(" B, lo max ");
+            uart_puts(utoa(lo.wait_max, buf, 10));
+            uart_puts_P(" B, yields ");
+            uart_puts(utoa(lo.yields, buf, 10));
+            uart_puts_P("\r\n");
+        }
+#endif
+
+#if TWI_TRACE
+        // ---------------- I2C TRACE ----------------
+        // Záznamy transakcií z tejto iterácie v binárnom formáte (tools/twi_trace.py)
+        twi_trace_dump(uart_putc);
+#endif
     }
 
     return 0;
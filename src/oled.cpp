@@ -1,9 +1,14 @@
 #include <avr/io.h> 
+#include <avr/pgmspace.h>
 #include <util/delay.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include "twi.h"
 #include "oled.h"
+#if OLED_BUS == OLED_BUS_SOFT
+# include "swi2c.h"
+#endif
 
 /**
  * @file
@@ -26,197 +31,748 @@
 
 // --- Font --- //
 
-/**
- * @brief Štruktúra jedného znaku 5x7 v bitmapovej podobe.
- *
- * Každý znak má:
- * - ASCII kód @ref c,
- * - pole 5 stĺpcov @ref data, kde každý bit reprezentuje pixel v stĺpci.
- */
-typedef struct {
-    char c;          ///< ASCII znak
-    uint8_t data[5]; ///< Bitmapa znaku (5 vertikálnych stĺpcov)
-} Font5x7Char;
-
-/**
- * @brief Tabuľka znakov fontu 5x7 (číslice, veľké a malé písmená).
- *
- * Tabuľka obsahuje:
- * - medzeru a bodku,
- * - číslice 0–9,
- * - veľké písmená A–Z,
- * - malé písmená a–z.
- *
- * Pri vykresľovaní sa podľa znaku vyhľadá zodpovedajúca bitmapa.
- */
-static const Font5x7Char font_table[] = {
-    // medzera + bodka
-    { ' ', {0x00,0x00,0x00,0x00,0x00} },
-    { '.', {0x00,0x00,0x00,0x18,0x18} },
-
-    // číslice
-    { '0',{0x3E,0x51,0x49,0x45,0x3E} },
-    { '1',{0x00,0x42,0x7F,0x40,0x00} },
-    { '2',{0x42,0x61,0x51,0x49,0x46} },
-    { '3',{0x21,0x41,0x45,0x4B,0x31} },
-    { '4',{0x18,0x14,0x12,0x7F,0x10} },
-    { '5',{0x27,0x45,0x45,0x45,0x39} },
-    { '6',{0x3C,0x4A,0x49,0x49,0x30} },
-    { '7',{0x01,0x71,0x09,0x05,0x03} },
-    { '8',{0x36,0x49,0x49,0x49,0x36} },
-    { '9',{0x06,0x49,0x49,0x29,0x1E} },
-
-    // veľké písmená A–Z
-    { 'A',{0x7E,0x09,0x09,0x09,0x7E} },
-    { 'B',{0x7F,0x49,0x49,0x49,0x36} },
-    { 'C',{0x3E,0x41,0x41,0x41,0x22} },
-    { 'D',{0x7F,0x41,0x41,0x22,0x1C} },
-    { 'E',{0x7F,0x49,0x49,0x49,0x41} },
-    { 'F',{0x7F,0x09,0x09,0x09,0x01} },
-    { 'G',{0x3E,0x41,0x49,0x49,0x3A} },
-    { 'H',{0x7F,0x08,0x08,0x08,0x7F} },
-    { 'I',{0x00,0x41,0x7F,0x41,0x00} },
-    { 'J',{0x20,0x40,0x41,0x3F,0x01} },
-    { 'K',{0x7F,0x08,0x14,0x22,0x41} },
-    { 'L',{0x7F,0x40,0x40,0x40,0x40} },
-    { 'M',{0x7F,0x02,0x0C,0x02,0x7F} },
-    { 'N',{0x7F,0x06,0x18,0x60,0x7F} },
-    { 'O',{0x3E,0x41,0x41,0x41,0x3E} },
-    { 'P',{0x7F,0x09,0x09,0x09,0x06} },
-    { 'Q',{0x3E,0x41,0x51,0x21,0x5E} },
-    { 'R',{0x7F,0x09,0x19,0x29,0x46} },
-    { 'S',{0x26,0x49,0x49,0x49,0x32} },
-    { 'T',{0x01,0x01,0x7F,0x01,0x01} },
-    { 'U',{0x3F,0x40,0x40,0x40,0x3F} },
-    { 'V',{0x07,0x38,0x40,0x38,0x07} },
-    { 'W',{0x7F,0x20,0x18,0x20,0x7F} },
-    { 'X',{0x63,0x14,0x08,0x14,0x63} },
-    { 'Y',{0x03,0x04,0x78,0x04,0x03} },
-    { 'Z',{0x61,0x51,0x49,0x45,0x43} },
-
-    // malé písmená a–z
-    { 'a',{0x20,0x54,0x54,0x54,0x78} },
-    { 'b',{0x7F,0x48,0x44,0x44,0x38} },
-    { 'c',{0x38,0x44,0x44,0x44,0x20} },
-    { 'd',{0x38,0x44,0x44,0x48,0x7F} },
-    { 'e',{0x38,0x54,0x54,0x54,0x18} },
-    { 'f',{0x08,0x7E,0x09,0x01,0x02} },
-    { 'g',{0x0C,0x52,0x52,0x52,0x3E} },
-    { 'h',{0x7F,0x08,0x04,0x04,0x78} },
-    { 'i',{0x00,0x44,0x7D,0x40,0x00} },
-    { 'j',{0x20,0x40,0x44,0x3D,0x00} },
-    { 'k',{0x7F,0x10,0x28,0x44,0x00} },
-    { 'l',{0x00,0x41,0x7F,0x40,0x00} },
-    { 'm',{0x7C,0x04,0x18,0x04,0x78} },
-    { 'n',{0x7C,0x08,0x04,0x04,0x78} },
-    { 'o',{0x38,0x44,0x44,0x44,0x38} },
-    { 'p',{0x7C,0x14,0x14,0x14,0x08} },
-    { 'q',{0x08,0x14,0x14,0x18,0x7C} },
-    { 'r',{0x7C,0x08,0x04,0x04,0x08} },
-    { 's',{0x48,0x54,0x54,0x54,0x20} },
-    { 't',{0x04,0x3F,0x44,0x40,0x20} },
-    { 'u',{0x3C,0x40,0x40,0x20,0x7C} },
-    { 'v',{0x1C,0x20,0x40,0x20,0x1C} },
-    { 'w',{0x3C,0x40,0x30,0x40,0x3C} },
-    { 'x',{0x44,0x28,0x10,0x28,0x44} },
-    { 'y',{0x0C,0x50,0x50,0x50,0x3C} },
-    { 'z',{0x44,0x64,0x54,0x4C,0x44} },
-};
+/** @brief Prvý znak v tabuľke fontu (medzera). */
+#define FONT_FIRST   0x20
+/** @brief Index náhradného znaku – všetko mimo 0x20–0x7E sa kreslí ako rámik. */
+#define FONT_MISSING 0x7F
 
 /**
- * @brief Počet položiek v tabuľke fontu @ref font_table.
+ * @brief Font 5x7 vo flash pamäti, indexovaný priamo ASCII kódom.
+ *
+ * Riadok @c font5x7[c - FONT_FIRST] = 5 vertikálnych stĺpcov znaku @c c
+ * (bit 0 = horný pixel). Tabuľka pokrýva celú tlačiteľnú ASCII 0x20–0x7E
+ * (medzera, interpunkcia, číslice, veľké a malé písmená); pozícia 0x7F
+ * je náhradný znak pre kódy mimo tohto rozsahu.
+ *
+ * Leží v PROGMEM, takže pri štarte sa nekopíruje do SRAM (pôvodná
+ * tabuľka {znak, bitmapa} zaberala 384 B SRAM) a znak sa nehľadá –
+ * index je jedno odčítanie.
  */
-#define FONT_TABLE_SIZE (sizeof(font_table)/sizeof(Font5x7Char))
+static const uint8_t font5x7[FONT_MISSING - FONT_FIRST + 1][5] PROGMEM = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00 },  // 0x20 ' '
+    { 0x00, 0x00, 0x5F, 0x00, 0x00 },  // 0x21 '!'
+    { 0x00, 0x07, 0x00, 0x07, 0x00 },  // 0x22 '"'
+    { 0x14, 0x7F, 0x14, 0x7F, 0x14 },  // 0x23 '#'
+    { 0x24, 0x2A, 0x7F, 0x2A, 0x12 },  // 0x24 '$'
+    { 0x23, 0x13, 0x08, 0x64, 0x62 },  // 0x25 '%'
+    { 0x36, 0x49, 0x55, 0x22, 0x50 },  // 0x26 '&'
+    { 0x00, 0x05, 0x03, 0x00, 0x00 },  // 0x27 '\''
+    { 0x00, 0x1C, 0x22, 0x41, 0x00 },  // 0x28 '('
+    { 0x00, 0x41, 0x22, 0x1C, 0x00 },  // 0x29 ')'
+    { 0x08, 0x2A, 0x1C, 0x2A, 0x08 },  // 0x2A '*'
+    { 0x08, 0x08, 0x3E, 0x08, 0x08 },  // 0x2B '+'
+    { 0x00, 0x50, 0x30, 0x00, 0x00 },  // 0x2C ','
+    { 0x08, 0x08, 0x08, 0x08, 0x08 },  // 0x2D '-'
+    { 0x00, 0x00, 0x00, 0x18, 0x18 },  // 0x2E '.'
+    { 0x20, 0x10, 0x08, 0x04, 0x02 },  // 0x2F '/'
+    { 0x3E, 0x51, 0x49, 0x45, 0x3E },  // 0x30 '0'
+    { 0x00, 0x42, 0x7F, 0x40, 0x00 },  // 0x31 '1'
+    { 0x42, 0x61, 0x51, 0x49, 0x46 },  // 0x32 '2'
+    { 0x21, 0x41, 0x45, 0x4B, 0x31 },  // 0x33 '3'
+    { 0x18, 0x14, 0x12, 0x7F, 0x10 },  // 0x34 '4'
+    { 0x27, 0x45, 0x45, 0x45, 0x39 },  // 0x35 '5'
+    { 0x3C, 0x4A, 0x49, 0x49, 0x30 },  // 0x36 '6'
+    { 0x01, 0x71, 0x09, 0x05, 0x03 },  // 0x37 '7'
+    { 0x36, 0x49, 0x49, 0x49, 0x36 },  // 0x38 '8'
+    { 0x06, 0x49, 0x49, 0x29, 0x1E },  // 0x39 '9'
+    { 0x00, 0x36, 0x36, 0x00, 0x00 },  // 0x3A ':'
+    { 0x00, 0x56, 0x36, 0x00, 0x00 },  // 0x3B ';'
+    { 0x00, 0x08, 0x14, 0x22, 0x41 },  // 0x3C '<'
+    { 0x14, 0x14, 0x14, 0x14, 0x14 },  // 0x3D '='
+    { 0x41, 0x22, 0x14, 0x08, 0x00 },  // 0x3E '>'
+    { 0x02, 0x01, 0x51, 0x09, 0x06 },  // 0x3F '?'
+    { 0x32, 0x49, 0x79, 0x41, 0x3E },  // 0x40 '@'
+    { 0x7E, 0x09, 0x09, 0x09, 0x7E },  // 0x41 'A'
+    { 0x7F, 0x49, 0x49, 0x49, 0x36 },  // 0x42 'B'
+    { 0x3E, 0x41, 0x41, 0x41, 0x22 },  // 0x43 'C'
+    { 0x7F, 0x41, 0x41, 0x22, 0x1C },  // 0x44 'D'
+    { 0x7F, 0x49, 0x49, 0x49, 0x41 },  // 0x45 'E'
+    { 0x7F, 0x09, 0x09, 0x09, 0x01 },  // 0x46 'F'
+    { 0x3E, 0x41, 0x49, 0x49, 0x3A },  // 0x47 'G'
+    { 0x7F, 0x08, 0x08, 0x08, 0x7F },  // 0x48 'H'
+    { 0x00, 0x41, 0x7F, 0x41, 0x00 },  // 0x49 'I'
+    { 0x20, 0x40, 0x41, 0x3F, 0x01 },  // 0x4A 'J'
+    { 0x7F, 0x08, 0x14, 0x22, 0x41 },  // 0x4B 'K'
+    { 0x7F, 0x40, 0x40, 0x40, 0x40 },  // 0x4C 'L'
+    { 0x7F, 0x02, 0x0C, 0x02, 0x7F },  // 0x4D 'M'
+    { 0x7F, 0x06, 0x18, 0x60, 0x7F },  // 0x4E 'N'
+    { 0x3E, 0x41, 0x41, 0x41, 0x3E },  // 0x4F 'O'
+    { 0x7F, 0x09, 0x09, 0x09, 0x06 },  // 0x50 'P'
+    { 0x3E, 0x41, 0x51, 0x21, 0x5E },  // 0x51 'Q'
+    { 0x7F, 0x09, 0x19, 0x29, 0x46 },  // 0x52 'R'
+    { 0x26, 0x49, 0x49, 0x49, 0x32 },  // 0x53 'S'
+    { 0x01, 0x01, 0x7F, 0x01, 0x01 },  // 0x54 'T'
+    { 0x3F, 0x40, 0x40, 0x40, 0x3F },  // 0x55 'U'
+    { 0x07, 0x38, 0x40, 0x38, 0x07 },  // 0x56 'V'
+    { 0x7F, 0x20, 0x18, 0x20, 0x7F },  // 0x57 'W'
+    { 0x63, 0x14, 0x08, 0x14, 0x63 },  // 0x58 'X'
+    { 0x03, 0x04, 0x78, 0x04, 0x03 },  // 0x59 'Y'
+    { 0x61, 0x51, 0x49, 0x45, 0x43 },  // 0x5A 'Z'
+    { 0x00, 0x7F, 0x41, 0x41, 0x00 },  // 0x5B '['
+    { 0x02, 0x04, 0x08, 0x10, 0x20 },  // 0x5C '\\'
+    { 0x00, 0x41, 0x41, 0x7F, 0x00 },  // 0x5D ']'
+    { 0x04, 0x02, 0x01, 0x02, 0x04 },  // 0x5E '^'
+    { 0x40, 0x40, 0x40, 0x40, 0x40 },  // 0x5F '_'
+    { 0x00, 0x01, 0x02, 0x04, 0x00 },  // 0x60 '`'
+    { 0x20, 0x54, 0x54, 0x54, 0x78 },  // 0x61 'a'
+    { 0x7F, 0x48, 0x44, 0x44, 0x38 },  // 0x62 'b'
+    { 0x38, 0x44, 0x44, 0x44, 0x20 },  // 0x63 'c'
+    { 0x38, 0x44, 0x44, 0x48, 0x7F },  // 0x64 'd'
+    { 0x38, 0x54, 0x54, 0x54, 0x18 },  // 0x65 'e'
+    { 0x08, 0x7E, 0x09, 0x01, 0x02 },  // 0x66 'f'
+    { 0x0C, 0x52, 0x52, 0x52, 0x3E },  // 0x67 'g'
+    { 0x7F, 0x08, 0x04, 0x04, 0x78 },  // 0x68 'h'
+    { 0x00, 0x44, 0x7D, 0x40, 0x00 },  // 0x69 'i'
+    { 0x20, 0x40, 0x44, 0x3D, 0x00 },  // 0x6A 'j'
+    { 0x7F, 0x10, 0x28, 0x44, 0x00 },  // 0x6B 'k'
+    { 0x00, 0x41, 0x7F, 0x40, 0x00 },  // 0x6C 'l'
+    { 0x7C, 0x04, 0x18, 0x04, 0x78 },  // 0x6D 'm'
+    { 0x7C, 0x08, 0x04, 0x04, 0x78 },  // 0x6E 'n'
+    { 0x38, 0x44, 0x44, 0x44, 0x38 },  // 0x6F 'o'
+    { 0x7C, 0x14, 0x14, 0x14, 0x08 },  // 0x70 'p'
+    { 0x08, 0x14, 0x14, 0x18, 0x7C },  // 0x71 'q'
+    { 0x7C, 0x08, 0x04, 0x04, 0x08 },  // 0x72 'r'
+    { 0x48, 0x54, 0x54, 0x54, 0x20 },  // 0x73 's'
+    { 0x04, 0x3F, 0x44, 0x40, 0x20 },  // 0x74 't'
+    { 0x3C, 0x40, 0x40, 0x20, 0x7C },  // 0x75 'u'
+    { 0x1C, 0x20, 0x40, 0x20, 0x1C },  // 0x76 'v'
+    { 0x3C, 0x40, 0x30, 0x40, 0x3C },  // 0x77 'w'
+    { 0x44, 0x28, 0x10, 0x28, 0x44 },  // 0x78 'x'
+    { 0x0C, 0x50, 0x50, 0x50, 0x3C },  // 0x79 'y'
+    { 0x44, 0x64, 0x54, 0x4C, 0x44 },  // 0x7A 'z'
+    { 0x00, 0x08, 0x36, 0x41, 0x00 },  // 0x7B '{'
+    { 0x00, 0x00, 0x7F, 0x00, 0x00 },  // 0x7C '|'
+    { 0x00, 0x41, 0x36, 0x08, 0x00 },  // 0x7D '}'
+    { 0x10, 0x08, 0x08, 0x10, 0x08 },  // 0x7E '~'
+    { 0x7F, 0x41, 0x41, 0x41, 0x7F },  // 0x7F – náhradný znak (rámik)
+};
 
 /**
- * @brief Vyhľadá bitmapu znaku v tabuľke fontu.
+ * @brief Vráti adresu bitmapy znaku vo flash pamäti.
  *
- * Funkcia prejde @ref font_table a vráti ukazovateľ na bitmapu
- * zodpovedajúceho znaku. Ak znak v tabuľke nie je, vráti bitmapu
- * medzery (prvý prvok tabuľky).
+ * Znaky mimo 0x20–0x7E dostanú náhradný znak @ref FONT_MISSING.
+ * Bajty sa čítajú cez @c pgm_read_byte.
  *
  * @param c Znak, ktorého bitmapu chceme získať.
- * @return Ukazovateľ na pole 5 bajtov reprezentujúcich bitmapu znaku.
+ * @return Adresa 5 bajtov bitmapy vo flash pamäti (PROGMEM).
  */
 static const uint8_t* font_get_char(char c) {
-    for (uint8_t i = 0; i < FONT_TABLE_SIZE; i++) {
-        if (font_table[i].c == c) {
-            return font_table[i].data;
-        }
+    uint8_t i = (uint8_t)c - FONT_FIRST;
+
+    if (i > FONT_MISSING - FONT_FIRST) i = FONT_MISSING - FONT_FIRST;
+    return font5x7[i];
+}
+
+/** @brief Šírka znaku veľkého fontu v stĺpcoch (bodka je užšia, @ref FONT_TALL_DOT_W). */
+#define FONT_TALL_W     10
+#define FONT_TALL_DOT_W 4
+/** @brief Prázdne stĺpce za každým znakom veľkého fontu. */
+#define FONT_TALL_GAP   2
+/** @brief Počet znakov veľkého fontu: medzera, 0–9, '.', 'M', 'H', 'z'. */
+#define FONT_TALL_COUNT 15
+/** @brief Index bodky vo @ref font_tall. */
+#define FONT_TALL_DOT   11
+
+/**
+ * @brief Veľký font frekvencie 10x14 (dve stránky) vo flash pamäti.
+ *
+ * @c font_tall[i][0] = stĺpce hornej stránky, @c font_tall[i][1] dolnej.
+ * Tabuľku generuje @c tools/bigfont.py z fontu 5x7 (Scale2x – vyhladené
+ * šikmé hrany), za behu sa nič neškáluje: kreslenie je len kopírovanie
+ * bajtov z flash do dátového prúdu.
+ */
+static const uint8_t font_tall[FONT_TALL_COUNT][2][FONT_TALL_W] PROGMEM = {
+    { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // ' ', šírka 10
+      { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+    { { 0xF8, 0xFC, 0x0E, 0x06, 0x86, 0xC6, 0x66, 0x66, 0xFC, 0xF8 },   // '0', šírka 10
+      { 0x1F, 0x3F, 0x66, 0x66, 0x63, 0x61, 0x60, 0x70, 0x3F, 0x1F } },
+    { { 0x00, 0x00, 0x18, 0x3C, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00 },   // '1', šírka 10
+      { 0x00, 0x00, 0x60, 0x70, 0x7F, 0x7F, 0x70, 0x60, 0x00, 0x00 } },
+    { { 0x18, 0x1C, 0x0E, 0x06, 0x06, 0x06, 0x86, 0xCE, 0xFC, 0x78 },   // '2', šírka 10
+      { 0x60, 0x70, 0x78, 0x7C, 0x66, 0x67, 0x63, 0x61, 0x60, 0x60 } },
+    { { 0x06, 0x06, 0x06, 0x06, 0x66, 0xE6, 0x9E, 0x9E, 0x0E, 0x06 },   // '3', šírka 10
+      { 0x18, 0x38, 0x70, 0x60, 0x60, 0x60, 0x61, 0x73, 0x3F, 0x1E } },
+    { { 0x80, 0xC0, 0x60, 0x70, 0x18, 0x1C, 0xFE, 0xFE, 0x00, 0x00 },   // '4', šírka 10
+      { 0x03, 0x07, 0x06, 0x06, 0x06, 0x0F, 0x7F, 0x7F, 0x0F, 0x06 } },
+    { { 0x3C, 0x7E, 0x66, 0x66, 0x66, 0x66, 0x66, 0xE6, 0xC6, 0x86 },   // '5', šírka 10
+      { 0x18, 0x38, 0x70, 0x60, 0x60, 0x60, 0x60, 0x70, 0x3F, 0x1F } },
+    { { 0xE0, 0xF0, 0x98, 0x9C, 0x8E, 0x86, 0x86, 0x86, 0x00, 0x00 },   // '6', šírka 10
+      { 0x1F, 0x3F, 0x73, 0x61, 0x61, 0x61, 0x61, 0x73, 0x3F, 0x1E } },
+    { { 0x06, 0x06, 0x06, 0x06, 0x86, 0xC6, 0xE6, 0x66, 0x3E, 0x1C },   // '7', šírka 10
+      { 0x00, 0x00, 0x7E, 0x7F, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00 } },
+    { { 0x78, 0x7C, 0xCE, 0x86, 0x86, 0x86, 0x86, 0xCE, 0x7C, 0x78 },   // '8', šírka 10
+      { 0x1E, 0x3E, 0x73, 0x61, 0x61, 0x61, 0x61, 0x73, 0x3E, 0x1E } },
+    { { 0x78, 0xFC, 0xCE, 0x86, 0x86, 0x86, 0x86, 0xCE, 0xFC, 0xF8 },   // '9', šírka 10
+      { 0x00, 0x00, 0x61, 0x61, 0x61, 0x71, 0x39, 0x19, 0x0F, 0x07 } },
+    { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },   // '.', šírka 4
+      { 0x30, 0x78, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
+    { { 0xFE, 0xFE, 0x1C, 0x18, 0xE0, 0xE0, 0x18, 0x1C, 0xFE, 0xFE },   // 'M', šírka 10
+      { 0x7F, 0x7F, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x7F, 0x7F } },
+    { { 0xFE, 0xFE, 0xC0, 0x80, 0x80, 0x80, 0x80, 0xC0, 0xFE, 0xFE },   // 'H', šírka 10
+      { 0x7F, 0x7F, 0x03, 0x01, 0x01, 0x01, 0x01, 0x03, 0x7F, 0x7F } },
+    { { 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xE0, 0xE0, 0x60 },   // 'z', šírka 10
+      { 0x60, 0x70, 0x78, 0x7C, 0x66, 0x66, 0x63, 0x61, 0x60, 0x60 } },
+};
+
+/**
+ * @brief Index znaku @p c vo @ref font_tall; znaky mimo fontu sú medzera.
+ */
+static uint8_t font_tall_index(char c) {
+    if (c >= '0' && c <= '9') return 1 + (c - '0');
+    switch (c) {
+    case '.': return FONT_TALL_DOT;
+    case 'M': return 12;
+    case 'H': return 13;
+    case 'z': return 14;
+    default:  return 0;
     }
-    // fallback – medzera
-    return font_table[0].data;
+}
+
+/**
+ * @brief Šírka znaku veľkého fontu v stĺpcoch vrátane medzery za ním.
+ */
+static uint8_t font_tall_width(uint8_t i) {
+    return (i == FONT_TALL_DOT ? FONT_TALL_DOT_W : FONT_TALL_W) + FONT_TALL_GAP;
 }
 
 
 // --- OLED I2C pomocné funkcie --- //
 
+/** @brief Šírka displeja v stĺpcoch. */
+#define OLED_WIDTH    128
+/** @brief Najväčší blok z RAM v jednej dátovej transakcii (úsek prúdu, 8 znakov 5x7). */
+#define OLED_XFER_BUF 48
+
+/// Nulový bajt pre mazanie (@ref TWI_XF_FILL).
+static const uint8_t s_zero = 0x00;
+
+/// Počítadlá prenosov pre @ref oled_get_bus_stats.
+static uint32_t s_bus_bytes = 0;
+static uint16_t s_bus_xfers = 0;
+
+#if OLED_BUS == OLED_BUS_SOFT
+/// Buffer úseku dátového prúdu.
+static uint8_t s_stream_buf[OLED_XFER_BUF];
+
 /**
- * @brief Pošle jeden príkazový bajt OLED displeju cez I2C.
+ * @brief Vráti buffer pre ďalší úsek dátového prúdu.
+ */
+static uint8_t *oled_buf(void) {
+    return s_stream_buf;
+}
+
+/**
+ * @brief Pošle OLED jednu transakciu po programovej I2C zbernici (@ref swi2c).
  *
- * Vykoná sekvenciu:
- * - START,
- * - SLA+W,
- * - označenie príkazu @ref OLED_CMD,
- * - samotný príkaz @p cmd,
- * - STOP.
+ * Transakcia = SLA+W, riadiaci bajt @p ctrl a @p len bajtov; funkcia sa
+ * vráti po STOP. Hardvérové TWI medzitým obsluhuje tuner v prerušení.
  *
- * @param cmd Príkazový bajt pre OLED.
+ * @param ctrl  Riadiaci bajt (@ref OLED_CMD / @ref OLED_DATA).
+ * @param data  Dáta (RAM, PROGMEM podľa @p flags; pri @ref TWI_XF_FILL jeden bajt).
+ * @param len   Počet bajtov.
+ * @param flags @ref TWI_XF_PGM alebo @ref TWI_XF_FILL, inak 0.
  */
-static void oled_send_command(uint8_t cmd) {
-    twi_start();
-    twi_write((OLED_ADDR << 1) | 0);
-    twi_write(OLED_CMD);
-    twi_write(cmd);
-    twi_stop();
+static void oled_send(uint8_t ctrl, const uint8_t *data, uint8_t len, uint8_t flags) {
+    uint8_t sw = 0;
+
+    if (flags & TWI_XF_PGM)  sw |= SWI2C_PGM;
+    if (flags & TWI_XF_FILL) sw |= SWI2C_FILL;
+    swi2c_write_reg(OLED_ADDR, ctrl, data, len, sw);
+    s_bus_bytes += 2 + len;
+    s_bus_xfers++;
 }
+#else
+/** @brief Počet transakcií OLED, ktoré môžu naraz čakať vo fronte TWI (zvyšok fronty ostáva tuneru). */
+#define OLED_XFER_SLOTS 2
+
+/// Popisovače transakcií a ich buffre.
+static twi_xfer_t s_xfer[OLED_XFER_SLOTS];
+static uint8_t    s_xfer_buf[OLED_XFER_SLOTS][OLED_XFER_BUF];
+/// Ďalší použitý popisovač.
+static uint8_t    s_xfer_next = 0;
 
 /**
- * @brief Začne I2C prenos dát pre OLED (bez ukončenia STOP).
+ * @brief Vráti buffer ďalšieho popisovača (počká, kým sa uvoľní).
  *
- * Po zavolaní je možné posielať dáta funkciou @ref oled_send_data_byte
- * a prenos sa ukončí až volaním @ref oled_send_data_stop.
+ * Dáta zapísané priamo sem pošle nasledujúci @ref oled_send bez kopírovania.
  */
-static void oled_send_data_start(void) {
-    twi_start();
-    twi_write((OLED_ADDR << 1) | 0);
-    twi_write(OLED_DATA);
+static uint8_t *oled_buf(void) {
+    twi_wait(&s_xfer[s_xfer_next]);
+    return s_xfer_buf[s_xfer_next];
 }
 
 /**
- * @brief Pošle jeden dátový bajt OLED displeju.
+ * @brief Zaradí do fronty TWI jednu transakciu pre OLED a nečaká na jej dokončenie.
+ *
+ * Transakcia = SLA+W, riadiaci bajt @p ctrl (@ref OLED_CMD / @ref OLED_DATA)
+ * a @p len bajtov. Dáta z RAM sa skopírujú do buffra popisovača (ak tam
+ * už nie sú – @ref oled_buf), takže volajúci môže svoj buffer hneď znovu
+ * použiť. Čaká sa len vtedy, ak je popisovač ešte obsadený predošlou transakciou.
+ *
+ * Transakcie majú nízku prioritu (@ref TWI_XF_LOW) – čítania tunera idú
+ * pred ne; dátové prenosy sa smú deliť na úseky (@ref TWI_XF_CHUNK),
+ * príkazy nie (parameter by sa oddelil od príkazu).
  *
- * Pred volaním musí byť pripravený dátový režim
- * pomocou @ref oled_send_data_start.
+ * @param ctrl  Riadiaci bajt.
+ * @param data  Dáta (RAM, PROGMEM podľa @p flags; pri @ref TWI_XF_FILL jeden bajt).
+ * @param len   Počet bajtov.
+ * @param flags @ref TWI_XF_PGM alebo @ref TWI_XF_FILL, inak 0 (RAM, najviac @ref OLED_XFER_BUF).
+ */
+static void oled_send(uint8_t ctrl, const uint8_t *data, uint8_t len, uint8_t flags) {
+    twi_xfer_t *x = &s_xfer[s_xfer_next];
+    uint8_t *buf  = s_xfer_buf[s_xfer_next];
+
+    s_xfer_next = (s_xfer_next + 1) % OLED_XFER_SLOTS;
+    twi_wait(x);
+
+    if ((flags & TWI_XF_PGM) || data == buf) {
+        x->wbuf = data;
+    } else {
+        uint8_t n = (flags & TWI_XF_FILL) ? 1 : len;
+        for (uint8_t i = 0; i < n; i++) buf[i] = data[i];
+        x->wbuf = buf;
+    }
+    x->addr  = OLED_ADDR;
+    x->flags = TWI_XF_REG | TWI_XF_LOW | flags | ((ctrl == OLED_DATA) ? TWI_XF_CHUNK : 0);
+    x->reg   = ctrl;
+    x->wlen  = len;
+    x->rlen  = 0;
+    x->done  = 0;
+    twi_submit_wait(x);
+    s_bus_bytes += 2 + len;
+    s_bus_xfers++;
+}
+#endif
+
+static void oled_ticker_pause(void);
+
+/**
+ * @brief Nastaví okno displeja – stĺpce @p col0 až @p col1 na stránkach @p page0 až @p page1.
+ *
+ * Pri horizontálnom adresovaní (0x20 0x00) dáta plnia okno stĺpec po
+ * stĺpci a stránku po stránke, takže celý obdĺžnik (reťazec, riadok,
+ * obrazovka) sa pošle jedným dátovým prúdom. Namiesto troch príkazov
+ * pozície na každý znak stačí jedna transakcia: 0x21 col0 col1 0x22 page0 page1.
+ * Bežiaci hardvérový posun sa pred zápisom zastaví (@ref oled_ticker_pause).
+ *
+ * @param page0 Prvá stránka (0–7).
+ * @param page1 Posledná stránka (0–7).
+ * @param col0  Prvý stĺpec (0–127).
+ * @param col1  Posledný stĺpec (0–127).
+ */
+static void oled_window(uint8_t page0, uint8_t page1, uint8_t col0, uint8_t col1) {
+    uint8_t cmd[6];
+
+    oled_ticker_pause();
+    cmd[0] = 0x21;
+    cmd[1] = col0;
+    cmd[2] = col1;
+    cmd[3] = 0x22;
+    cmd[4] = page0 & 0x07;
+    cmd[5] = page1 & 0x07;
+    oled_send(OLED_CMD, cmd, sizeof(cmd), 0);
+}
+
+
+// --- Dátový prúd --- //
+
+/// Buffer rozpracovaného úseku prúdu (@ref oled_buf) a počet bajtov v ňom.
+static uint8_t *s_stream;
+static uint8_t  s_stream_len = 0;
+
+/**
+ * @brief Odošle rozpracovaný úsek dátového prúdu.
+ *
+ * Volať na konci každého prúdu, pred ďalším príkazom.
+ */
+static void oled_stream_flush(void) {
+    if (!s_stream_len) return;
+    oled_send(OLED_DATA, s_stream, s_stream_len, 0);
+    s_stream_len = 0;
+}
+
+/**
+ * @brief Pridá bajt do dátového prúdu; plný úsek (@ref OLED_XFER_BUF) sa hneď odošle.
+ */
+static void oled_stream_put(uint8_t b) {
+    if (!s_stream_len) s_stream = oled_buf();
+    s_stream[s_stream_len++] = b;
+    if (s_stream_len == OLED_XFER_BUF) oled_stream_flush();
+}
+
+// --- Framebuffer stránok --- //
+
+/** @brief Počet stránok v @ref OLED_FB_PAGES. */
+#define OLED_FB_NPAGES (((OLED_FB_PAGES >> 0) & 1) + ((OLED_FB_PAGES >> 1) & 1) + \
+                        ((OLED_FB_PAGES >> 2) & 1) + ((OLED_FB_PAGES >> 3) & 1) + \
+                        ((OLED_FB_PAGES >> 4) & 1) + ((OLED_FB_PAGES >> 5) & 1) + \
+                        ((OLED_FB_PAGES >> 6) & 1) + ((OLED_FB_PAGES >> 7) & 1))
+
+/// Obsah bufferovaných stránok tak, ako je (po @ref oled_fb_flush) na displeji.
+static uint8_t s_fb[OLED_FB_NPAGES ? OLED_FB_NPAGES : 1][OLED_WIDTH];
+/// Zmenené stĺpce stránky @c s_fb_lo..s_fb_hi (lo > hi = bez zmien).
+static uint8_t s_fb_lo[OLED_FB_NPAGES ? OLED_FB_NPAGES : 1];
+static uint8_t s_fb_hi[OLED_FB_NPAGES ? OLED_FB_NPAGES : 1];
+
+/// Cieľ kreslenia: riadok framebuffera aktuálnej stránky (NULL = nebufferovaná) a jeho stĺpec.
+static uint8_t *s_put_row = NULL;
+static uint8_t  s_put_col;
+static uint8_t  s_put_col0;
+static int8_t   s_put_slot;
+/// Rozsah stránok kreslenia; @c s_put_direct = priamo do dátového prúdu.
+static uint8_t  s_put_page0;
+static uint8_t  s_put_page1;
+static bool     s_put_direct;
+
+/**
+ * @brief Index stránky @p page v @ref s_fb, alebo -1 ak stránka nie je bufferovaná.
+ */
+static int8_t oled_fb_slot(uint8_t page) {
+    if (!(OLED_FB_PAGES & (1 << page))) return -1;
+
+    int8_t n = 0;
+    for (uint8_t p = 0; p < page; p++)
+        if (OLED_FB_PAGES & (1 << p)) n++;
+    return n;
+}
+
+/**
+ * @brief Označí všetky bufferované stránky ako zhodné s displejom.
+ */
+static void oled_fb_clean(void) {
+    for (uint8_t i = 0; i < OLED_FB_NPAGES; i++) {
+        s_fb_lo[i] = 0xFF;
+        s_fb_hi[i] = 0;
+    }
+}
+
+/**
+ * @brief Pošle na displej zmenené úseky stránok @p page0 až @p page1 (ak nejaké sú).
  *
- * @param b Dátový bajt (stĺpec pixelov).
+ * Jedno okno cez zmenené stránky a zjednotenie ich zmenených stĺpcov
+ * (s_fb_lo..s_fb_hi) a jeden dátový prúd, takže zmena jednej číslice
+ * stojí ~20 bajtov zbernice (dvojstránková číslica ~30) a nezmenená
+ * stránka nič.
  */
-static void oled_send_data_byte(uint8_t b) { twi_write(b); }
+static void oled_fb_flush(uint8_t page0, uint8_t page1) {
+    uint8_t lo = 0xFF, hi = 0;
+    uint8_t first = 0xFF, last = 0;
+
+    for (uint8_t p = page0; p <= page1; p++) {
+        int8_t slot = oled_fb_slot(p);
+
+        if (slot < 0 || s_fb_lo[slot] > s_fb_hi[slot]) continue;
+        if (s_fb_lo[slot] < lo) lo = s_fb_lo[slot];
+        if (s_fb_hi[slot] > hi) hi = s_fb_hi[slot];
+        if (first == 0xFF) first = p;
+        last = p;
+        s_fb_lo[slot] = 0xFF;
+        s_fb_hi[slot] = 0;
+    }
+    if (first == 0xFF) return;
+
+    oled_window(first, last, lo, hi);
+    for (uint8_t p = first; p <= last; p++) {
+        const uint8_t *row = s_fb[oled_fb_slot(p)];
+
+        for (uint8_t c = lo; ; c++) {
+            oled_stream_put(row[c]);
+            if (c == hi) break;
+        }
+    }
+    oled_stream_flush();
+}
 
 /**
- * @brief Ukončí aktuálny I2C prenos dát (vygeneruje STOP).
+ * @brief Presunie kreslenie na začiatok (stĺpec col0) stránky @p page.
+ *
+ * Pri kreslení cez viac stránok (@ref oled_put_begin_pages) sa volá pred
+ * každou stránkou v poradí page0..page1 – okno displeja po poslednom
+ * stĺpci samo prejde na ďalšiu stránku, framebuffer treba prepnúť.
  */
-static void oled_send_data_stop(void) { twi_stop(); }
+static void oled_put_row(uint8_t page) {
+    s_put_slot = oled_fb_slot(page);
+    s_put_row  = (s_put_slot < 0) ? NULL : s_fb[s_put_slot];
+    s_put_col  = s_put_col0;
+}
 
 /**
- * @brief Nastaví pozíciu kurzora na danú stránku a stĺpec.
+ * @brief Začne kreslenie do stĺpcov @p col0 až @p col1 stránok @p page0 až @p page1.
  *
- * OLED displej má:
- * - stránkový režim (page 0–7) – vertikálne bloky po 8 pixeloch,
- * - 128 stĺpcov (adresované dolnými a hornými 4 bitmi).
+ * Ak sú všetky stránky bufferované (@ref OLED_FB_PAGES), kreslí sa do RAM
+ * a @ref oled_put_end pošle len zmeny, inak priamo – jedno okno a dátový
+ * prúd (bufferované stránky v rozsahu sa vtedy len prepíšu, aby ostali
+ * zhodné s displejom). Prvá je stránka @p page0, ďalšie cez
+ * @ref oled_put_row. Ukončiť volaním @ref oled_put_end.
+ */
+static void oled_put_begin_pages(uint8_t page0, uint8_t page1, uint8_t col0, uint8_t col1) {
+    s_put_direct = false;
+    for (uint8_t p = page0; p <= page1; p++)
+        if (oled_fb_slot(p) < 0) s_put_direct = true;
+
+    s_put_page0 = page0;
+    s_put_page1 = page1;
+    s_put_col0  = col0;
+    if (s_put_direct) oled_window(page0, page1, col0, col1);
+    oled_put_row(page0);
+}
+
+/**
+ * @brief Začne kreslenie do stĺpcov @p col0 až @p col1 stránky @p page.
+ */
+static void oled_put_begin(uint8_t page, uint8_t col0, uint8_t col1) {
+    oled_put_begin_pages(page, page, col0, col1);
+}
+
+/**
+ * @brief Vykreslí bajt (stĺpec) na ďalšiu pozíciu.
  *
- * Funkcia nastaví:
- * - číslo stránky (0xB0 | page),
- * - dolných 4 bity stĺpca,
- * - horných 4 bity stĺpca.
+ * Do framebuffera sa zapíše len zmenený bajt a rozšíri sa ním rozsah
+ * zmenených stĺpcov stránky.
+ */
+static void oled_put(uint8_t b) {
+    uint8_t c = s_put_col++;
+
+    if (s_put_direct) {
+        oled_stream_put(b);
+        if (s_put_row && c < OLED_WIDTH) s_put_row[c] = b;
+        return;
+    }
+    if (c >= OLED_WIDTH || s_put_row[c] == b) return;
+
+    s_put_row[c] = b;
+    if (c < s_fb_lo[s_put_slot]) s_fb_lo[s_put_slot] = c;
+    if (c > s_fb_hi[s_put_slot]) s_fb_hi[s_put_slot] = c;
+}
+
+/**
+ * @brief Ukončí kreslenie začaté @ref oled_put_begin a pošle zmeny na displej.
+ */
+static void oled_put_end(void) {
+    s_put_row = NULL;
+    if (s_put_direct) oled_stream_flush();
+    else              oled_fb_flush(s_put_page0, s_put_page1);
+}
+
+/**
+ * @brief Vykreslí @p n nulových stĺpcov.
+ */
+static void oled_put_blank(uint8_t n) {
+    while (n--) oled_put(0x00);
+}
+
+/**
+ * @brief Vykreslí znak fontu 5x7 a jeden prázdny stĺpec (6 bajtov).
+ */
+static void oled_put_glyph(char c) {
+    const uint8_t *glyph = font_get_char(c);
+
+    for (uint8_t i = 0; i < 5; i++) oled_put(pgm_read_byte(&glyph[i]));
+    oled_put(0x00);
+}
+
+/**
+ * @brief Počet znakov reťazca @p s, ktoré sa od stĺpca @p col zmestia na riadok.
  *
- * @param page Číslo stránky (0–7).
- * @param col  Stĺpec, od ktorého sa bude kresliť.
+ * @param w    Šírka znaku v stĺpcoch.
+ * @param last Najväčší stĺpec, na ktorom smie znak začínať.
  */
-static void oled_set_pos(uint8_t page, uint8_t col) {
-    oled_send_command(0xB0 | (page & 0x07));
-    oled_send_command(0x00 | (col & 0x0F));
-    oled_send_command(0x10 | ((col >> 4) & 0x0F));
+static uint8_t oled_fit(uint8_t col, const char *s, uint8_t w, uint8_t last) {
+    uint8_t n = 0;
+
+    while (s[n] && col <= last) {
+        n++;
+        col += w;
+    }
+    return n;
+}
+
+
+// --- Bežiaci text (hardvérový posun SSD1306) --- //
+
+/// Čas v ms od štartu (implementovaný v main.cpp).
+extern unsigned long timer_millis();
+
+/// Text bežiaceho riadku (za textom medzery do @ref OLED_TICKER_LEN).
+static char     s_tick_text[OLED_TICKER_LEN + 1];
+/// Počet znakov textu v aktuálnom kole (bez medzier na konci).
+static uint8_t  s_tick_len;
+/// Dĺžka kola v stĺpcoch (0 = bežiaci riadok stojí).
+static uint16_t s_tick_lap = 0;
+/// Stĺpec prúdu textu na adrese 0 pri poslednom spustení posunu.
+static uint16_t s_tick_base;
+/// Stĺpec prúdu textu na adrese 0 pri poslednom zápise celého riadku.
+static uint16_t s_tick_sync;
+/// Ďalší stĺpec prúdu textu, ktorý ešte nie je v RAM displeja.
+static uint16_t s_tick_next;
+/// Čas spustenia posunu (ms).
+static unsigned long s_tick_t0;
+/// Posun na displeji beží (0x2F) – RAM displeja sa vtedy nesmie zapisovať.
+static bool     s_tick_run = false;
+
+/**
+ * @brief Počet znakov @p s bez medzier na konci (najviac @ref OLED_TICKER_LEN).
+ */
+static uint8_t oled_ticker_trim(const char *s) {
+    uint8_t n = 0;
+
+    for (uint8_t i = 0; i < OLED_TICKER_LEN && s[i]; i++)
+        if (s[i] != ' ') n = i + 1;
+    return n;
+}
+
+/**
+ * @brief Stĺpec @p s prúdu textu – znaky po 6 stĺpcoch a medzera 3 znakov na konci kola.
+ */
+static uint8_t oled_ticker_col(uint16_t s) {
+    s %= s_tick_lap;
+
+    uint8_t ch = s / 6;
+    uint8_t i  = s % 6;
+
+    if (ch >= s_tick_len || i == 5) return 0x00;
+    return pgm_read_byte(&font_get_char(s_tick_text[ch])[i]);
+}
+
+/**
+ * @brief Počet krokov posunu od jeho spustenia (odhad z času, 0 ak posun stojí).
+ */
+static uint16_t oled_ticker_steps(void) {
+    if (!s_tick_run) return 0;
+    return (timer_millis() - s_tick_t0) * 1000UL / OLED_TICKER_STEP_US;
+}
+
+/**
+ * @brief Zastaví posun (0x2E) pred zápisom do RAM displeja.
+ *
+ * SSD1306 počas posunu nedovoľuje prístup do RAM; volá sa z
+ * @ref oled_window pred každým zápisom. Posun mení obsah RAM, takže po
+ * zastavení v nej ostane posunutý riadok – odhadnuté kroky sa pripočítajú
+ * k @ref s_tick_base a posun sa po snímke spustí znovu (@ref oled_ticker_poll).
+ */
+static void oled_ticker_pause(void) {
+    static const uint8_t cmd[] PROGMEM = { 0x2E };
+
+    if (!s_tick_run) return;
+    s_tick_base += oled_ticker_steps();
+    s_tick_run = false;
+    oled_send(OLED_CMD, cmd, sizeof(cmd), TWI_XF_PGM);
+}
+
+/**
+ * @brief Spustí posun doľava (0x27) len stránky @ref OLED_TICKER_PAGE o jeden stĺpec každých 5 snímok.
+ *
+ * Stĺpec, ktorý odíde vľavo, sa vráti vpravo.
+ */
+static void oled_ticker_resume(void) {
+    static const uint8_t scroll[] PROGMEM = {
+        0x27, 0x00, OLED_TICKER_PAGE, 0x00, OLED_TICKER_PAGE, 0x00, 0xFF,   // doľava, 5 snímok/krok
+        0x2F                                                                // spustiť
+    };
+
+    if (!s_tick_lap || s_tick_run) return;
+    oled_send(OLED_CMD, scroll, sizeof(scroll), TWI_XF_PGM);
+    s_tick_t0  = timer_millis();
+    s_tick_run = true;
+}
+
+/**
+ * @brief Zapíše stĺpce prúdu @p base až @p base + 127 a spustí posun odznova.
+ *
+ * Dĺžka kola sa prepočíta z aktuálneho textu.
+ *
+ * @param base Stĺpec prúdu textu na adrese 0.
+ */
+static void oled_ticker_restart(uint16_t base) {
+    oled_ticker_pause();
+    s_tick_len = oled_ticker_trim(s_tick_text);
+    s_tick_lap = 6 * (s_tick_len + 3);
+    if (s_tick_lap < OLED_WIDTH) s_tick_lap = OLED_WIDTH;
+    base %= s_tick_lap;
+
+    oled_window(OLED_TICKER_PAGE, OLED_TICKER_PAGE, 0, OLED_WIDTH - 1);
+    for (uint8_t c = 0; c < OLED_WIDTH; c++) oled_stream_put(oled_ticker_col(base + c));
+    oled_stream_flush();
+
+    s_tick_base = base;
+    s_tick_sync = base;
+    s_tick_next = base + OLED_WIDTH;
+    oled_ticker_resume();
+}
+
+/**
+ * @brief Zastaví bežiaci riadok a vymaže jeho stránku.
+ */
+void oled_ticker_stop(void) {
+    if (!s_tick_lap) return;
+
+    oled_ticker_pause();
+    s_tick_lap = 0;
+    oled_window(OLED_TICKER_PAGE, OLED_TICKER_PAGE, 0, OLED_WIDTH - 1);
+    oled_send(OLED_DATA, &s_zero, OLED_WIDTH, TWI_XF_FILL);
+}
+
+/**
+ * @brief Nastaví text bežiaceho riadku (napr. RDS RadioText).
+ *
+ * Bežiaci riadok sa pri zmene textu nereštartuje – zmenené znaky sa
+ * dostanú na displej, keď na ne príde rad pri dopĺňaní stĺpcov
+ * (@ref oled_ticker_poll), nová dĺžka platí od ďalšieho kola. Zvyšok
+ * buffra sa doplní medzerami, takže kratší text v dobiehajúcom kole
+ * prekryje koniec dlhšieho prázdnymi stĺpcami. Reštartuje sa len krátky
+ * text, ktorý sa celý zmestí na displej (ten sa nedopĺňa). Prázdny text
+ * (alebo samé medzery) bežiaci riadok zastaví.
+ *
+ * @param text Text, najviac @ref OLED_TICKER_LEN znakov.
+ */
+void oled_ticker_text(const char *text) {
+    uint8_t i = 0;
+
+    for (; i < OLED_TICKER_LEN && text[i]; i++) s_tick_text[i] = text[i];
+    for (; i < OLED_TICKER_LEN; i++) s_tick_text[i] = ' ';
+    s_tick_text[i] = '\0';
+
+    if (!oled_ticker_trim(s_tick_text))
+        oled_ticker_stop();
+    else if (s_tick_lap <= OLED_WIDTH)
+        oled_ticker_restart(0);
+}
+
+/**
+ * @brief Doplní do RAM displeja stĺpce textu, ktoré posun priniesol na pravý okraj, a spustí posun.
+ *
+ * Poloha posunu sa odhaduje z času (@ref OLED_TICKER_STEP_US): po p
+ * krokoch je na adrese a stĺpec prúdu base + p + a a adresy, ktoré sa
+ * vrátili vpravo, ešte držia stĺpce, ktoré už odišli. Keď ich je aspoň
+ * na celý znak, posun sa zastaví, prepíšu sa jedným oknom ďalšími
+ * stĺpcami textu a posun sa spustí znovu (~29 B na znak). Po
+ * @ref OLED_TICKER_SYNC_STEPS krokoch od zápisu celého riadku sa riadok
+ * zapíše znovu od odhadnutej polohy – to ohraničí odchýlku odhadu od
+ * skutočných hodín displeja (aj zlomky krokov stratené pri zastaveniach).
+ *
+ * Posun zastavený zápisom inej stránky počas snímky sa tu spustí znovu.
+ * Volať pravidelne (aspoň raz za 6 krokov posunu) a po každom kreslení.
+ */
+void oled_ticker_poll(void) {
+    if (!s_tick_lap) return;
+
+    if (s_tick_lap > OLED_WIDTH) {
+        uint16_t left = s_tick_base + oled_ticker_steps();  // stĺpec prúdu na adrese 0
+        uint16_t end  = left + OLED_WIDTH - 1;             // stĺpec prúdu na adrese 127
+
+        if ((uint16_t)(left - s_tick_sync) >= OLED_TICKER_SYNC_STEPS) {
+            oled_ticker_restart(left);
+            return;
+        }
+        if (s_tick_next < left) s_tick_next = left;        // tieto stĺpce už odišli vľavo
+        if (end + 1 - s_tick_next >= 6) {
+            oled_window(OLED_TICKER_PAGE, OLED_TICKER_PAGE, s_tick_next - left, OLED_WIDTH - 1);
+            for (uint16_t s = s_tick_next; s <= end; s++) oled_stream_put(oled_ticker_col(s));
+            oled_stream_flush();
+            s_tick_next = end + 1;
+        }
+    }
+    oled_ticker_resume();
 }
 
 
@@ -225,17 +781,19 @@ static void oled_set_pos(uint8_t page, uint8_t col) {
 /**
  * @brief Vymaže celý OLED displej (všetky stránky a stĺpce).
  *
- * Pre každú stránku (0–7):
- * - nastaví stĺpec na 0,
- * - zapíše 132 bajtov hodnôt 0x00 (čierne pixely).
+ * Jedno okno cez celú obrazovku a 8 dátových transakcií po 128 nulách
+ * (@ref TWI_XF_FILL – bez buffra v RAM). Bežiaci riadok sa zastaví.
  */
 void oled_clear(void) {
-    for (uint8_t page = 0; page < 8; page++) {
-        oled_set_pos(page, 0);
-        oled_send_data_start();
-        for (uint8_t i = 0; i < 132; i++) oled_send_data_byte(0x00);
-        oled_send_data_stop();
-    }
+    oled_ticker_pause();
+    s_tick_lap = 0;
+    for (uint8_t i = 0; i < OLED_FB_NPAGES; i++)
+        for (uint8_t c = 0; c < OLED_WIDTH; c++) s_fb[i][c] = 0;
+    oled_fb_clean();
+
+    oled_window(0, 7, 0, OLED_WIDTH - 1);
+    for (uint8_t page = 0; page < 8; page++)
+        oled_send(OLED_DATA, &s_zero, OLED_WIDTH, TWI_XF_FILL);
 }
 
 
@@ -244,187 +802,298 @@ void oled_clear(void) {
 /**
  * @brief Vykreslí jeden znak fontu 5x7 na danú stránku a stĺpec.
  *
- * Postup:
- * - získa bitmapu znaku cez @ref font_get_char,
- * - nastaví pozíciu kurzora na @p page a @p *col,
- * - postupne pošle 5 stĺpcov bitmapy,
- * - pridá jeden prázdny stĺpec ako medzeru medzi znakmi,
- * - po vykreslení posunie @p *col o 6 stĺpcov.
+ * 5 stĺpcov bitmapy a prázdny stĺpec ako medzera (priamo oknom šírky
+ * znaku, na bufferovanej stránke len zmenené stĺpce); @p *col sa
+ * posunie o 6 stĺpcov.
  *
  * @param page Stránka (0–7), na ktorej sa má znak vykresliť.
  * @param col  Ukazovateľ na aktuálny stĺpec; po vykreslení bude posunutý.
  * @param c    Znak, ktorý sa má vykresliť.
  */
 void oled_draw_char(uint8_t page, uint8_t *col, char c) {
-    const uint8_t *glyph = font_get_char(c);
-    oled_set_pos(page, *col);
-    oled_send_data_start();
-    for (uint8_t i = 0; i < 5; i++) oled_send_data_byte(glyph[i]);
-    oled_send_data_byte(0x00);
-    oled_send_data_stop();
+    oled_put_begin(page, *col, *col + 5);
+    oled_put_glyph(c);
+    oled_put_end();
     *col += 6;
 }
 
 /**
  * @brief Vykreslí C-reťazec na danú stránku od zvoleného stĺpca.
  *
- * Iteratívne volá @ref oled_draw_char, kým:
- * - nenarazí na koniec reťazca,
- * - alebo by ďalší znak presiahol šírku displeja (kontrola @p col <= 122).
+ * Celý reťazec ide jedným oknom a jedným dátovým prúdom (6 bajtov na
+ * znak, po @ref OLED_XFER_BUF bajtoch na transakciu); na bufferovanej
+ * stránke (@ref OLED_FB_PAGES) len úsek, ktorý sa zmenil. Znaky, ktoré by
+ * presiahli šírku displeja (začiatok za stĺpcom 122), sa vynechajú.
  *
  * @param page Stránka (0–7), na ktorej sa text vykresľuje.
  * @param col  Počiatočný stĺpec.
  * @param s    Nulou ukončený C-reťazec.
  */
 void oled_draw_string(uint8_t page, uint8_t col, const char *s) {
-    while (*s && col <= 122) oled_draw_char(page, &col, *s++);
+    uint8_t n = oled_fit(col, s, 6, 122);
+
+    if (!n) return;
+    oled_put_begin(page, col, col + 6 * n - 1);
+    for (uint8_t i = 0; i < n; i++) oled_put_glyph(s[i]);
+    oled_put_end();
 }
 
 /**
- * @brief Vykreslí jeden „zväčšený“ znak – jednoduchý väčší font.
+ * @brief Vykreslí celý riadok: prázdne stĺpce pred textom, text a zvyšok riadku zmaže.
  *
- * Základný znak 5x7 je roztiahnutý horizontálne:
- * - každý druhý stĺpec sa duplikuje,
- * - výsledná šírka znaku je väčšia (viac pixelov).
+ * Nahrádza mazanie stránky + @ref oled_draw_string jedným oknom cez
+ * celú stránku a jedným prúdom 128 bajtov – bez preblikania a so
+ * zmazaním zvyšku dlhšieho predošlého textu.
+ *
+ * @param page Stránka (0–7).
+ * @param col  Stĺpec začiatku textu.
+ * @param s    Nulou ukončený C-reťazec.
+ */
+static void oled_draw_line(uint8_t page, uint8_t col, const char *s) {
+    uint8_t n = oled_fit(col, s, 6, 122);
+
+    oled_put_begin(page, 0, OLED_WIDTH - 1);
+    oled_put_blank(col);
+    for (uint8_t i = 0; i < n; i++) oled_put_glyph(s[i]);
+    oled_put_blank(OLED_WIDTH - col - 6 * n);
+    oled_put_end();
+}
+
+/**
+ * @brief Vykreslí text do poľa – stĺpce @p col až @p end, zvyšok poľa zmaže.
  *
- * Používa sa pre výrazné zobrazenie frekvencie rádia.
+ * Jedno okno a jeden prúd cez celé pole, takže kratší text prepíše
+ * dlhší predošlý bez mazania celej stránky; znaky za @p end sa vynechajú.
  *
- * @param page Stránka, kde sa má znak vykresliť.
- * @param col  Ukazovateľ na stĺpec; po vykreslení sa posunie o 9.
- * @param c    Znak, ktorý sa má vykresliť.
+ * @param page Stránka (0–7).
+ * @param col  Prvý stĺpec poľa (začiatok textu).
+ * @param end  Posledný stĺpec poľa (0–127).
+ * @param s    Nulou ukončený C-reťazec.
  */
-void oled_draw_char_big(uint8_t page, uint8_t *col, char c) {
-    const uint8_t *glyph = font_get_char(c);
-    oled_set_pos(page, *col);
-    oled_send_data_start();
-    for (uint8_t i = 0; i < 5; i++) {
-        uint8_t d = glyph[i];
-        oled_send_data_byte(d);
-        if (i % 2 == 0) oled_send_data_byte(d);
-    }
-    oled_send_data_byte(0);
-    oled_send_data_stop();
-    *col += 9;
+void oled_draw_field(uint8_t page, uint8_t col, uint8_t end, const char *s) {
+    if (end < col) return;
+
+    uint8_t n = (end - col >= 5) ? oled_fit(col, s, 6, end - 5) : 0;
+
+    oled_put_begin(page, col, end);
+    for (uint8_t i = 0; i < n; i++) oled_put_glyph(s[i]);
+    oled_put_blank(end + 1 - col - 6 * n);
+    oled_put_end();
 }
 
 /**
- * @brief Vykreslí reťazec vo „väčšom“ fonte (používa @ref oled_draw_char_big).
+ * @brief Vykreslí reťazec veľkým fontom (@ref font_tall) cez stránky @p page a @p page + 1.
  *
- * Vhodné pre zobrazenie frekvencie (napr. „107.0MHz“) viac na veľko.
+ * Celý reťazec ide jedným oknom cez obe stránky a jedným dátovým prúdom –
+ * najprv horné polovice znakov, potom dolné, bajty priamo z flash. Na
+ * bufferovaných stránkach (@ref OLED_FB_PAGES) sa pošle jedno okno len
+ * cez zmenené stĺpce. Znaky, ktoré by presiahli šírku displeja, sa vynechajú.
  *
- * @param page Stránka, kde sa má text vykresliť.
+ * @param page Horná stránka (0–6).
  * @param col  Počiatočný stĺpec.
- * @param s    Nulou ukončený C-reťazec.
+ * @param s    Nulou ukončený C-reťazec (číslice, '.', 'M', 'H', 'z', medzera).
+ */
+static void oled_draw_string_tall(uint8_t page, uint8_t col, const char *s) {
+    uint8_t n = 0;
+    uint16_t end = col;
+
+    while (s[n] && end + font_tall_width(font_tall_index(s[n])) <= OLED_WIDTH)
+        end += font_tall_width(font_tall_index(s[n++]));
+    if (!n) return;
+
+    oled_put_begin_pages(page, page + 1, col, end - 1);
+    for (uint8_t half = 0; half < 2; half++) {
+        if (half) oled_put_row(page + 1);
+        for (uint8_t i = 0; i < n; i++) {
+            uint8_t g = font_tall_index(s[i]);
+            uint8_t w = font_tall_width(g) - FONT_TALL_GAP;
+            const uint8_t *cols = font_tall[g][half];
+
+            for (uint8_t k = 0; k < w; k++) oled_put(pgm_read_byte(&cols[k]));
+            oled_put_blank(FONT_TALL_GAP);
+        }
+    }
+    oled_put_end();
+}
+
+/**
+ * @brief Vráti počítadlá prenosov OLED od štartu.
  */
-void oled_draw_string_big(uint8_t page, uint8_t col, const char *s) {
-    while (*s && col <= 118) oled_draw_char_big(page, &col, *s++);
+void oled_get_bus_stats(uint32_t *bytes, uint16_t *xfers) {
+    *bytes = s_bus_bytes;
+    *xfers = s_bus_xfers;
 }
 
 
 // --- Inicializácia OLED --- //
 
+/**
+ * @brief Inicializačná sekvencia príkazov SSD1306 (vo flash pamäti).
+ */
+static const uint8_t oled_init_cmds[] PROGMEM = {
+    0xAE,               // displej vypnutý
+    0x20, 0x00,         // horizontálne adresovanie
+    0x21, 0x00, 0x7F,   // okno: stĺpce 0–127
+    0x22, 0x00, 0x07,   //       stránky 0–7
+    0xC8,               // smer skenovania COM
+    0x40,               // počiatočný riadok 0
+    0x81, 0x7F,         // kontrast
+    0xA1,               // zrkadlenie segmentov
+    0xA6,               // normálne (nie inverzné) zobrazenie
+    0xA8, 0x3F,         // multiplex 64
+    0xA4,               // obraz z RAM
+    0xD3, 0x00,         // bez posunu
+    0xD5, 0xF0,         // hodiny displeja
+    0xD9, 0x22,         // pre-charge
+    0xDA, 0x12,         // konfigurácia COM pinov
+    0xDB, 0x20,         // VCOMH
+    0x8D, 0x14,         // nábojová pumpa zapnutá
+    0xAF                // displej zapnutý
+};
+
+/**
+ * @brief Nastaví rýchlosť I2C zbernice pre transakcie OLED displeja.
+ *
+ * @param hz Rýchlosť SCL v Hz.
+ */
+void oled_set_speed(uint32_t hz) {
+#if OLED_BUS == OLED_BUS_TWI
+    twi_set_speed(OLED_ADDR, hz);
+#else
+    (void)hz;
+#endif
+}
+
 /**
  * @brief Inicializuje OLED displej (I2C rozhranie a základná konfigurácia).
  *
  * Kroky:
- * - inicializuje TWI/I2C volaním @ref twi_init,
+ * - inicializuje TWI/I2C volaním @ref twi_init, nastaví rýchlosť @ref OLED_SCL_HZ
+ *   a rozpočet @ref OLED_BUS_BUDGET
+ *   (pri @ref OLED_BUS_SOFT programovú zbernicu @ref swi2c_init),
  * - počká cca 100 ms po napájaní,
- * - pošle sériu inicializačných príkazov podľa datasheetu,
- * - zapne displej (0xAF),
+ * - pošle sériu inicializačných príkazov podľa datasheetu (@ref oled_init_cmds)
+ *   v jednej transakcii; posledný príkaz zapne displej (0xAF),
  * - vymaže obrazovku volaním @ref oled_clear.
  */
 void oled_init(void) {
+#if OLED_BUS == OLED_BUS_SOFT
+    swi2c_init();
+#else
     twi_init();
+    oled_set_speed(OLED_SCL_HZ);
+    twi_sched_budget(OLED_BUS_BUDGET);
+#endif
     _delay_ms(100);
-    oled_send_command(0xAE);
-    oled_send_command(0x20); oled_send_command(0x00);
-    oled_send_command(0xB0);
-    oled_send_command(0xC8);
-    oled_send_command(0x00);
-    oled_send_command(0x10);
-    oled_send_command(0x40);
-    oled_send_command(0x81); oled_send_command(0x7F);
-    oled_send_command(0xA1);
-    oled_send_command(0xA6);
-    oled_send_command(0xA8); oled_send_command(0x3F);
-    oled_send_command(0xA4);
-    oled_send_command(0xD3); oled_send_command(0x00);
-    oled_send_command(0xD5); oled_send_command(0xF0);
-    oled_send_command(0xD9); oled_send_command(0x22);
-    oled_send_command(0xDA); oled_send_command(0x12);
-    oled_send_command(0xDB); oled_send_command(0x20);
-    oled_send_command(0x8D); oled_send_command(0x14);
-    oled_send_command(0xAF);
+    oled_send(OLED_CMD, oled_init_cmds, sizeof(oled_init_cmds), TWI_XF_PGM);
     oled_clear();
 }
 
 /**
- * @brief Vyčistí jednu konkrétnu stránku OLED displeja.
+ * @brief Krátka hláška v spodnom riadku (page 7) cez celý riadok.
  *
- * Používa sa napríklad pri mazaní spodného riadku s hláškou.
+ * Kreslí ju vrstva hlášok @ref screen_toast, ktorá ju po uplynutí
+ * času zmaže (@p s = "" vyčistí riadok). Page 7 hlavná obrazovka
+ * nepoužíva, takže hláška nič neprekryje.
  *
- * @param page Číslo stránky (0–7), ktorá sa má vymazať.
+ * @param s Text hlášky (najviac 20 znakov sa zmestí).
  */
-static void oled_clear_page(uint8_t page)
+void oled_show_toast(const char *s)
 {
-    oled_set_pos(page, 0);
-    oled_send_data_start();
-    for (uint8_t i = 0; i < 132; i++)
-        oled_send_data_byte(0x00);
-    oled_send_data_stop();
+    oled_draw_line(7, 4, s);
 }
 
+
+// --- Hlavná obrazovka rádia --- //
+
+/** @brief Ľavý okraj textu hlavnej obrazovky (stĺpec). */
+#define OLED_X0 4
+
 /**
- * @brief Zobrazí krátku hlášku o uložení obľúbenej stanice v spodnom riadku.
+ * @brief Hlavička v hornom riadku (page 0), stĺpce 0–103.
  *
- * Postup:
- * - prepočíta @p freq_khz na formát MHz (napr. 10700 → 107.0),
- * - pripraví text v tvare `"FAVORITE 107.0MHz"`,
- * - vymaže spodnú stránku (page 7),
- * - vykreslí text s menším horizontálnym odsadením,
- * - nechá správu svietiť ~3 sekundy,
- * - znovu vymaže spodný riadok.
+ * - „FM Radio is power off“ pri vypnutom rádiu – cez celý riadok,
+ *   prekryje aj režim enkódera (@ref oled_show_mode),
+ * - „FM Radio is Mute“ pri stlmení,
+ * - „FM Radio“ inak.
  *
- * @param freq_khz Frekvencia uložená ako obľúbená, v kHz.
+ * @param on    @c false = rádio vypnuté.
+ * @param muted @c true = zvuk stlmený.
  */
-void oled_show_favorite_saved_bottom(int freq_khz)
+void oled_show_header(bool on, bool muted)
 {
-    int mhz = freq_khz / 100;
-    int dec = (freq_khz % 100) / 10;
+    char line[22];
+
+    if (!on) {
+        strcpy_P(line, PSTR("FM Radio is power off"));
+        oled_draw_line(0, OLED_X0, line);
+    } else {
+        strcpy_P(line, muted ? PSTR("FM Radio is Mute") : PSTR("FM Radio"));
+        oled_draw_field(0, OLED_X0, 103, line);
+    }
+}
 
-    char line[24];
-    // opäť – použité len veľké písmená, ktoré máš vo fonte
-    snprintf(line, sizeof(line), "FAVORITE %3d.%1dMHz", mhz, dec);
+/**
+ * @brief Režim enkódera vpravo v hornom riadku („VOL“ / „TUNE“, stĺpce 104–127).
+ *
+ * @param tune @c true = enkóder ladí, @c false = mení hlasitosť.
+ */
+void oled_show_mode(bool tune)
+{
+    char line[5];
 
-    uint8_t x_offset = 4;
+    strcpy_P(line, tune ? PSTR("TUNE") : PSTR("VOL"));
+    oled_draw_field(0, 104, OLED_WIDTH - 1, line);
+}
 
-    // vyčisti spodný riadok (page 7 – nikde inde ju nepoužívaš)
-    oled_clear_page(7);
+/**
+ * @brief Frekvencia veľkým fontom (@ref font_tall) na page 3–4 („107.0MHz“).
+ *
+ * @param freq_khz Frekvencia v jednotkách ovládača (10 kHz, 10700 → 107.0 MHz).
+ */
+void oled_show_freq(int freq_khz)
+{
+    int mhz = freq_khz / 100;
+    int dec = (freq_khz % 100) / 10;
+    char line[16];
 
-    // vypíš hlášku na spodok
-    oled_draw_string(7, x_offset, line);
+    snprintf_P(line, sizeof(line), PSTR("%3d.%1dMHz"), mhz, dec);
+    oled_draw_string_tall(3, OLED_X0, line);
+}
 
-    // nech to svieti cca 3 sekundy
-    for (uint8_t i = 0; i < 3; i++) {
-        _delay_ms(1000);   // radšej po sekundách, ako jednu veľkú hodnotu
-    }
+/**
+ * @brief Hlasitosť na page 5 („Vol:10“, stĺpce 4–51).
+ */
+void oled_show_volume(int volume)
+{
+    char line[12];
 
-    // po 3 sekundách spodný riadok zmažeme
-    oled_clear_page(7);
+    snprintf_P(line, sizeof(line), PSTR("Vol:%2d"), volume);
+    oled_draw_field(5, OLED_X0, 51, line);
 }
 
+/**
+ * @brief RSSI na page 5 („RSSI:25“, stĺpce 52–99).
+ */
+void oled_show_rssi(int rssi)
+{
+    char line[12];
 
-// --- Hlavná obrazovka rádia --- //
+    snprintf_P(line, sizeof(line), PSTR("RSSI:%2d"), rssi);
+    oled_draw_field(5, 52, 99, line);
+}
 
 /**
  * @brief Zobrazí hlavnú obrazovku FM rádia (frekvencia, hlasitosť, RSSI, mute).
  *
  * Obrazovka obsahuje:
- * - horný riadok – hlavičku:
+ * - horný riadok – hlavičku (@ref oled_show_header):
  *   - „FM Radio is Mute“, ak je @p muted = true,
- *   - „FM Radio“, inak (s predchádzajúcim riadkom vyčisteným),
- * - stred – veľkým fontom frekvencia v tvare „107.0MHz“,
- * - spodný riadok – text „Vol:xx  RSSI:yy“.
+ *   - „FM Radio“, inak,
+ * - stred – veľkým fontom frekvencia v tvare „107.0MHz“ (@ref oled_show_freq),
+ * - spodný riadok – text „Vol:xx  RSSI:yy“ (@ref oled_show_volume, @ref oled_show_rssi).
+ *
+ * Prekreslí všetky prvky; po jednotlivých prvkoch podľa zmien kreslí @ref screen.h.
  *
  * @param freq_khz Frekvencia v kHz (napr. 10700 → 107.0 MHz).
  * @param volume   Hlasitosť (0–15 alebo podľa tunera).
@@ -433,58 +1102,34 @@ void oled_show_favorite_saved_bottom(int freq_khz)
  */
 void oled_show_radio_screen(int freq_khz, int volume, int rssi, bool muted)
 {
-    int mhz = freq_khz / 100;
-    int dec = (freq_khz % 100) / 10;
-
-    char freq_line[16];
-    char line3[20];
-
-    snprintf(freq_line, sizeof(freq_line), "%3d.%1dMHz", mhz, dec);
-    snprintf(line3, sizeof(line3), "Vol:%2d  RSSI:%2d", volume, rssi);
-
-    uint8_t x_offset = 4;
-
-    // Zobraz hlavičku
-    if (muted)
-        oled_draw_string(0, x_offset, "FM Radio is Mute");
-    else {
-        // Vyčisti starú hlavičku (ak predtým bolo mute)
-        oled_set_pos(0, 0);
-        oled_send_data_start();
-        for (uint8_t i = 0; i < 132; i++) oled_send_data_byte(0x00);
-        oled_send_data_stop();
-
-        oled_draw_string(0, x_offset, "FM Radio");
-    }
-
-    // Frekvencia a info
-    oled_draw_string_big(3, x_offset, freq_line);
-    oled_draw_string(5, x_offset, line3);
+    oled_show_header(true, muted);
+    oled_draw_field(0, 104, OLED_WIDTH - 1, "");     // bez režimu enkódera
+    oled_show_freq(freq_khz);
+    oled_show_volume(volume);
+    oled_show_rssi(rssi);
 }
 
 /**
  * @brief Zobrazí hlavičku pre stav, že FM rádio je vypnuté (power off).
  *
- * Funkcia:
- * - vyčistí horný riadok (page 0), kde predtým mohol byť text
- *   „FM Radio“ alebo „FM Radio is Mute“,
- * - vykreslí text „FM Radio is power off“ s malým odsadením.
+ * Vykreslí text „FM Radio is power off“ cez celý horný riadok (page 0),
+ * takže zmaže predošlú hlavičku „FM Radio“ alebo „FM Radio is Mute“.
  *
  * Používa sa pri dlhom stlačení dolného tlačidla, keď sa modul rádia
  * vypne volaním @c radio.powerDown().
  */
 void oled_show_power_off(void)
 {
-    uint8_t x_offset = 4;
+    oled_show_header(false, false);
+}
 
-    // vyčisti horný riadok (page 0), aby tam nezostal „FM Radio“ alebo „FM Radio is Mute“
-    oled_set_pos(0, 0);
-    oled_send_data_start();
-    for (uint8_t i = 0; i < 132; i++) {
-        oled_send_data_byte(0x00);
-    }
-    oled_send_data_stop();
+void oled_show_splash(void)
+{
+    char line[12];
 
-    // zobraz text „FM Radio is power off“ v hornom riadku
-    oled_draw_string(0, x_offset, "FM Radio is power off");
+    oled_clear();
+    strcpy_P(line, PSTR("FM Radio"));
+    oled_draw_string(2, 40, line);
+    strcpy_P(line, PSTR("Starting..."));
+    oled_draw_string(4, 34, line);
 }
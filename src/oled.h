@@ -17,6 +17,92 @@
  * - zobrazenie stavu vypnutého rádia.
  */
 
+/**
+ * @brief Rýchlosť I2C zbernice pre OLED (Hz).
+ *
+ * SSD1306 podporuje Fast-mode 400 kHz; TWI prepína rýchlosť podľa adresy
+ * zariadenia, takže pomalšie zariadenia na zbernici to neovplyvní.
+ */
+#ifndef OLED_SCL_HZ
+# define OLED_SCL_HZ 400000UL
+#endif
+
+/** @brief OLED na hardvérovom TWI (PC4/PC5), spoločná zbernica s Si4703. */
+#define OLED_BUS_TWI  0
+/** @brief OLED na programovej I2C zbernici (@ref swi2c, piny @ref SWI2C_SDA_PIN / @ref SWI2C_SCL_PIN). */
+#define OLED_BUS_SOFT 1
+
+/**
+ * @brief Zbernica OLED displeja (@ref OLED_BUS_TWI alebo @ref OLED_BUS_SOFT).
+ *
+ * Pri @ref OLED_BUS_SOFT prenos obrazovky nečaká vo fronte TWI pred
+ * čítaniami tunera (STC, RDS) – tie bežia súbežne v prerušení TWI,
+ * kým hlavná slučka posiela displej programovo. Vyberá sa pri preklade,
+ * napr. @c build_flags = -DOLED_BUS=1.
+ */
+#ifndef OLED_BUS
+# define OLED_BUS OLED_BUS_TWI
+#endif
+
+/**
+ * @brief Rozpočet zbernice pre OLED v bajtoch na snímku plánovača TWI (0 = bez obmedzenia).
+ *
+ * Transakcie displeja majú nízku prioritu a dátové prenosy sa delia
+ * na úseky (@ref TWI_XF_CHUNK). Pri nenulovom rozpočte pošle displej
+ * za snímku (@ref twi_sched_frame) najviac toľko bajtov, zvyšok ide
+ * v ďalšej snímke. Napr. 600 B za 20 ms ≈ 70 % zbernice pri 400 kHz.
+ */
+#ifndef OLED_BUS_BUDGET
+# define OLED_BUS_BUDGET 0
+#endif
+
+/**
+ * @brief Stránky displeja s kópiou v RAM (bitová maska, bit n = stránka n).
+ *
+ * Text na týchto stránkach sa kreslí do framebuffera (128 B na stránku)
+ * a na displej idú len stĺpce, ktoré sa zmenili – prekreslenie
+ * nezmenenej obrazovky nestojí žiadny bajt zbernice. Ostatné stránky
+ * sa kreslia priamo. Predvolene len veľká frekvencia (stránky 3–4,
+ * mení sa pri každom kroku ladenia) = 256 B SRAM; hlavička (0) a
+ * hlasitosť/RSSI (5) idú priamo oknom poľa. 0xFF = celý displej (1 KB)
+ * sa do 2 KB SRAM ATmega328P nezmestí, 0 = bez buffra. Frekvencia sa
+ * kreslí cez dve stránky – bufferuje sa, len ak sú v maske obe.
+ */
+#ifndef OLED_FB_PAGES
+# define OLED_FB_PAGES ((1 << 3) | (1 << 4))
+#endif
+
+/** @brief Stránka bežiaceho riadku (@ref oled_ticker_text), mimo @ref OLED_FB_PAGES. */
+#ifndef OLED_TICKER_PAGE
+# define OLED_TICKER_PAGE 1
+#endif
+
+/** @brief Najdlhší text bežiaceho riadku (RDS RadioText). */
+#define OLED_TICKER_LEN 64
+
+/**
+ * @brief Trvanie jedného kroku hardvérového posunu v µs.
+ *
+ * Posun o stĺpec každých 5 snímok displeja; pri hodinách z init
+ * sekvencie (0xD5 0xF0, 0xD9 0x22) je snímka ~6,6 ms. Hodiny SSD1306
+ * sa medzi modulmi líšia o jednotky %, pri inom module hodnotu doladiť
+ * (stopkami: čas 128 krokov = text obehne celý displej / 128).
+ */
+#ifndef OLED_TICKER_STEP_US
+# define OLED_TICKER_STEP_US 33000UL
+#endif
+
+/**
+ * @brief Po koľkých krokoch posunu sa bežiaci riadok zapíše znovu (synchronizácia).
+ *
+ * Polohu posunu displej nevie vrátiť, odhaduje sa z času; odchýlka
+ * hodín o 1 % posunie dopĺňané stĺpce o ~1 stĺpec za 128 krokov.
+ * Každá synchronizácia stojí ~155 B.
+ */
+#ifndef OLED_TICKER_SYNC_STEPS
+# define OLED_TICKER_SYNC_STEPS 128
+#endif
+
 /**
  * @brief Inicializuje OLED displej a pripraví ho na použitie.
  *
@@ -26,11 +112,20 @@
  */
 void oled_init(void);
 
+/**
+ * @brief Nastaví rýchlosť I2C zbernice pre OLED.
+ *
+ * Pri @ref OLED_BUS_SOFT nemá vplyv – rýchlosť je pevná (@ref SWI2C_HZ).
+ *
+ * @param hz Rýchlosť SCL v Hz (predvolene @ref OLED_SCL_HZ).
+ */
+void oled_set_speed(uint32_t hz);
+
 /**
  * @brief Vymaže celý obsah OLED displeja.
  *
- * Prejde všetky stránky (pages) displeja a do všetkých stĺpcov zapíše nulu,
- * čím vyčistí celý obraz. Po zavolaní je displej prázdny.
+ * Nastaví okno cez celý displej a do všetkých stránok (pages) a stĺpcov
+ * zapíše nulu, čím vyčistí celý obraz. Po zavolaní je displej prázdny.
  */
 void oled_clear(void);
 
@@ -55,7 +150,8 @@ void oled_draw_char(uint8_t page, uint8_t *col, char c);
 /**
  * @brief Vykreslí C-reťazec na danú stránku od zadaného stĺpca.
  *
- * Postupne volá @ref oled_draw_char pre každý znak reťazca, kým:
+ * Nastaví okno SSD1306 na šírku textu a pošle všetky znaky jedným
+ * dátovým prúdom (6 bajtov na znak), kým:
  * - nenarazí na koniec reťazca (`'\0'`),
  * - alebo nenarazí na koniec riadku (šírku displeja).
  *
@@ -65,6 +161,38 @@ void oled_draw_char(uint8_t page, uint8_t *col, char c);
  */
 void oled_draw_string(uint8_t page, uint8_t col, const char *s);
 
+/**
+ * @brief Vykreslí text do poľa stĺpcov @p col až @p end a zvyšok poľa zmaže.
+ *
+ * Kratší text tak prepíše dlhší predošlý bez mazania celej stránky
+ * a bez zásahu do susedných polí.
+ *
+ * @param page Stránka displeja, 0–7.
+ * @param col  Prvý stĺpec poľa (začiatok textu).
+ * @param end  Posledný stĺpec poľa, 0–127.
+ * @param s    Ukazovateľ na nulou ukončený C-reťazec.
+ */
+void oled_draw_field(uint8_t page, uint8_t col, uint8_t end, const char *s);
+
+/**
+ * @name Prvky hlavnej obrazovky
+ *
+ * Každý prvok kreslí len svoju časť obrazovky, takže sa dá prekresliť
+ * samostatne, keď sa zmení jeho hodnota (@ref screen.h).
+ * @{
+ */
+/** @brief Hlavička v hornom riadku – „FM Radio“, „FM Radio is Mute“ alebo pri @p on = false „FM Radio is power off“. */
+void oled_show_header(bool on, bool muted);
+/** @brief Režim enkódera vpravo v hornom riadku – „TUNE“ alebo „VOL“. */
+void oled_show_mode(bool tune);
+/** @brief Frekvencia veľkým fontom 10x14 na page 3–4 (jednotky 10 kHz, 10700 → „107.0MHz“). */
+void oled_show_freq(int freq_khz);
+/** @brief Hlasitosť v spodnom riadku („Vol:10“). */
+void oled_show_volume(int volume);
+/** @brief Úroveň signálu v spodnom riadku („RSSI:25“). */
+void oled_show_rssi(int rssi);
+/** @} */
+
 /**
  * @brief Zobrazí hlavnú obrazovku rádia (frekvencia, hlasitosť, RSSI, mute).
  *
@@ -73,6 +201,9 @@ void oled_draw_string(uint8_t page, uint8_t col, const char *s);
  * - vo väčšom fonte zobrazí aktuálnu frekvenciu (napr. `107.0MHz`),
  * - v spodnej časti zobrazí hlasitosť a RSSI.
  *
+ * Dá sa volať v každej slučke – na bufferovaných stránkach
+ * (@ref OLED_FB_PAGES) sa posielajú len zmenené stĺpce.
+ *
  * @param freq_khz Frekvencia v kHz (napr. 10700 → 107.0 MHz).
  * @param volume   Aktuálna hlasitosť (0–15 alebo podľa implementácie).
  * @param rssi     Hodnota RSSI (úroveň signálu z tunera).
@@ -81,24 +212,64 @@ void oled_draw_string(uint8_t page, uint8_t col, const char *s);
 void oled_show_radio_screen(int freq_khz, int volume, int rssi, bool muted);
 
 /**
- * @brief Krátko zobrazí informáciu o uložení obľúbenej stanice v spodnej časti.
+ * @brief Vykreslí krátku hlášku do spodného riadku displeja.
  *
- * Funkcia vykreslí text v štýle „FAVORITE 107.0MHz“ na spodnej časti
- * displeja tak, aby neprepísala hlavnú časť obrazovky rádia. Typicky sa používa
- * po úspešnom uložení aktuálnej frekvencie medzi obľúbené stanice.
+ * Text (napr. „FAVORITE 107.0MHz“) sa vykreslí na spodnú stránku tak,
+ * aby neprepísal hlavnú časť obrazovky rádia; @p s = "" riadok vymaže.
+ * Kedy sa hláška zobrazí a zmizne, riadi @ref screen_toast.
+ *
+ * @param s Text hlášky.
+ */
+void oled_show_toast(const char *s);
+
+/**
+ * @name Bežiaci riadok
  *
- * @param freq_khz Frekvencia v kHz, ktorá bola práve uložená.
+ * Text dlhší ako displej (RDS RadioText) na stránke @ref OLED_TICKER_PAGE
+ * posúva sám SSD1306 (0x27 / 0x2F). Text sa zapíše raz a potom sa
+ * dopĺňajú len stĺpce, ktoré posun prináša na pravý okraj – okolo
+ * 29 B na znak namiesto celej stránky na každý krok. Počas posunu
+ * SSD1306 nedovoľuje prístup do RAM, preto sa posun pred každým
+ * zápisom zastaví (0x2E) a po snímke spustí znovu (+13 B na snímku so
+ * zmenou). Text, ktorý sa zmestí na displej, stojí po zapísaní 0 B/s.
+ * @{
  */
-void oled_show_favorite_saved_bottom(int freq_khz);
+/** @brief Nastaví text (prázdny = zastaviť); zmeny sa prejavia pri dopĺňaní, nová dĺžka od ďalšieho kola. */
+void oled_ticker_text(const char *text);
+/** @brief Doplní stĺpce textu, ktoré posun priniesol na pravý okraj; volať pravidelne (napr. každú snímku). */
+void oled_ticker_poll(void);
+/** @brief Zastaví posun a vymaže stránku bežiaceho riadku. */
+void oled_ticker_stop(void);
+/** @} */
 
 /**
  * @brief Zobrazí informáciu, že FM rádio je vypnuté (power off).
  *
- * Funkcia vyčistí horný riadok displeja a zobrazí text
- * „FM Radio is power off“. Je určená na použitie v stave, keď je
+ * Funkcia prepíše celý horný riadok displeja textom
+ * „FM Radio is power off“ (@ref oled_show_header). Je určená na použitie v stave, keď je
  * tuner vypnutý (`radio.powerDown()`) a nechceme zobrazovať ani mute,
  * ani bežnú hlavnú obrazovku rádia.
  */
 void oled_show_power_off(void);
 
+/**
+ * @brief Zobrazí úvodnú obrazovku počas štartu rádia.
+ *
+ * Vyčistí displej a vypíše „FM Radio“ a „Starting...“. Kreslí sa,
+ * kým sa ustáľuje oscilátor tunera, takže štart nepredlžuje.
+ */
+void oled_show_splash(void);
+
+/**
+ * @brief Vráti počítadlá prenosov displeja od štartu.
+ *
+ * Bajty = adresa + riadiaci bajt + dáta každej transakcie (bez
+ * opakovanej adresy pri delení na úseky plánovačom TWI). Slúži na
+ * porovnanie ceny obrazoviek, napr. @ref oled_show_radio_screen.
+ *
+ * @param bytes Výstup: počet bajtov na zbernici.
+ * @param xfers Výstup: počet transakcií.
+ */
+void oled_get_bus_stats(uint32_t *bytes, uint16_t *xfers);
+
 #endif
@@ -0,0 +1,163 @@
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+#include "presets.h"
+
+/**
+ * @file
+ * @brief Implementácia banky predvolieb v EEPROM.
+ */
+
+/** @brief Najnižšia frekvencia, ktorú záznam vie uložiť (76,00 MHz v jednotkách 10 kHz). */
+#define PRESET_FREQ_BASE 7600
+/** @brief Krok hodnoty záznamu (50 kHz v jednotkách 10 kHz). */
+#define PRESET_FREQ_STEP 5
+
+/// Hodnota záznamu každej predvoľby (@ref PRESET_EMPTY = prázdna).
+static uint16_t s_value[PRESET_SLOTS];
+/// Pozícia najnovšieho záznamu v kruhu každej predvoľby.
+static uint8_t  s_head[PRESET_SLOTS];
+
+/**
+ * @brief Adresa záznamu @p pos v kruhu predvoľby @p slot.
+ */
+static uint8_t *preset_addr(uint8_t slot, uint8_t pos)
+{
+    return (uint8_t *)(uintptr_t)(PRESET_EEPROM_BASE
+                                  + ((uint16_t)slot * PRESET_RING + pos) * PRESET_RECORD_SIZE);
+}
+
+/**
+ * @brief CRC-6 záznamu (horných 6 bitov CRC-8 CCITT cez seq a hodnotu).
+ */
+static uint8_t preset_crc(uint8_t seq, uint16_t value)
+{
+    uint8_t crc = 0;
+    crc = _crc8_ccitt_update(crc, seq);
+    crc = _crc8_ccitt_update(crc, value >> 8);
+    crc = _crc8_ccitt_update(crc, value & 0xFF);
+    return crc >> 2;
+}
+
+/**
+ * @brief Prečíta a overí záznam.
+ *
+ * @param slot  Predvoľba.
+ * @param pos   Pozícia v kruhu.
+ * @param value Výstup – hodnota záznamu.
+ * @return true, ak záznam prešiel kontrolou CRC.
+ */
+static bool preset_read(uint8_t slot, uint8_t pos, uint16_t *value)
+{
+    uint8_t rec[PRESET_RECORD_SIZE];
+
+    eeprom_read_block(rec, preset_addr(slot, pos), PRESET_RECORD_SIZE);
+    *value = ((uint16_t)(rec[1] & 0x03) << 8) | rec[2];
+    return (rec[1] >> 2) == preset_crc(rec[0], *value);
+}
+
+/**
+ * @brief Nájde pozíciu najnovšieho záznamu v kruhu predvoľby.
+ *
+ * Záznamy aktuálneho obehu kruhu (pozície 0 až head) majú poradové čísla
+ * seq(0), seq(0)+1, …; záznamy predošlého obehu sú voči seq(0) „v mínuse“
+ * (rozdiel mod 256 ≥ @ref PRESET_RING). Hranica sa preto nájde binárnym
+ * vyhľadávaním – 5 čítaní pre kruh 21 záznamov.
+ */
+static uint8_t preset_find_head(uint8_t slot)
+{
+    uint8_t first = eeprom_read_byte(preset_addr(slot, 0));
+    uint8_t lo = 0;
+    uint8_t hi = PRESET_RING - 1;
+
+    while (lo < hi) {
+        uint8_t mid = (lo + hi + 1) / 2;
+        uint8_t seq = eeprom_read_byte(preset_addr(slot, mid));
+
+        if ((uint8_t)(seq - first) < PRESET_RING) lo = mid;
+        else                                      hi = mid - 1;
+    }
+    return lo;
+}
+
+/**
+ * @brief Načíta banku predvolieb.
+ *
+ * Pre každú predvoľbu: binárne vyhľadanie najnovšieho záznamu a jeho
+ * overenie CRC. Ak bol posledný zápis prerušený (zlé CRC), použije sa
+ * predošlý záznam kruhu.
+ */
+void preset_init(void)
+{
+    for (uint8_t slot = 0; slot < PRESET_SLOTS; slot++) {
+        uint8_t  head = preset_find_head(slot);
+        uint8_t  prev = head ? head - 1 : PRESET_RING - 1;
+        uint16_t value;
+
+        s_head[slot] = head;
+        if (preset_read(slot, head, &value) || preset_read(slot, prev, &value))
+            s_value[slot] = value;
+        else
+            s_value[slot] = PRESET_EMPTY;
+    }
+}
+
+/**
+ * @brief Vráti frekvenciu predvoľby.
+ */
+int preset_get(uint8_t slot)
+{
+    if (slot >= PRESET_SLOTS || s_value[slot] == PRESET_EMPTY) return 0;
+    return PRESET_FREQ_BASE + s_value[slot] * PRESET_FREQ_STEP;
+}
+
+/**
+ * @brief Uloží frekvenciu do predvoľby.
+ *
+ * Nový záznam ide na ďalšiu pozíciu kruhu s poradovým číslom o 1 vyšším.
+ * Poradové číslo sa zapisuje ako posledné – pri výpadku napájania počas
+ * zápisu ostane na pozícii staré číslo a za najnovší sa považuje predošlý záznam.
+ */
+void preset_save(uint8_t slot, int freq)
+{
+    if (slot >= PRESET_SLOTS) return;
+
+    uint16_t value = PRESET_EMPTY;
+    if (freq >= PRESET_FREQ_BASE) {
+        value = (freq - PRESET_FREQ_BASE) / PRESET_FREQ_STEP;
+        if (value >= PRESET_EMPTY) value = PRESET_EMPTY;
+    }
+    if (value == s_value[slot]) return;             // Bez zmeny – šetríme EEPROM
+
+    uint8_t seq = eeprom_read_byte(preset_addr(slot, s_head[slot])) + 1;
+    uint8_t pos = (s_head[slot] + 1 < PRESET_RING) ? s_head[slot] + 1 : 0;
+    uint8_t *addr = preset_addr(slot, pos);
+
+    eeprom_update_byte(addr + 2, value & 0xFF);
+    eeprom_update_byte(addr + 1, (preset_crc(seq, value) << 2) | (value >> 8));
+    eeprom_update_byte(addr, seq);
+
+    s_head[slot]  = pos;
+    s_value[slot] = value;
+}
+
+/**
+ * @brief Nájde predvoľbu s danou frekvenciou.
+ */
+int8_t preset_find(int freq)
+{
+    for (uint8_t slot = 0; slot < PRESET_SLOTS; slot++)
+        if (preset_get(slot) == freq) return slot;
+    return -1;
+}
+
+/**
+ * @brief Nájde ďalšiu obsadenú predvoľbu za @p slot (cyklicky).
+ */
+int8_t preset_next(uint8_t slot)
+{
+    for (uint8_t i = 1; i <= PRESET_SLOTS; i++) {
+        uint8_t s = (slot + i) % PRESET_SLOTS;
+        if (s_value[s] != PRESET_EMPTY) return s;
+    }
+    return -1;
+}
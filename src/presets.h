@@ -0,0 +1,95 @@
+#ifndef PRESETS_H
+#define PRESETS_H
+
+#include <stdint.h>
+#include <avr/io.h>
+
+/**
+ * @file
+ * @brief Banka predvolieb staníc v EEPROM s rozložením zápisov a CRC.
+ *
+ * Každá predvoľba má v EEPROM vlastný kruh @ref PRESET_RING záznamov
+ * po 3 bajtoch. Uloženie predvoľby zapíše jeden nový záznam na ďalšiu
+ * pozíciu kruhu, takže každá bunka sa prepíše len raz za
+ * @ref PRESET_RING uložení tej istej predvoľby.
+ *
+ * Záznam (3 bajty):
+ * - bajt 0: poradové číslo (seq, mod 256) – zapisuje sa ako posledný,
+ * - bajt 1: bity 7–2 = CRC-6 (seq + hodnota), bity 1–0 = hodnota[9:8],
+ * - bajt 2: hodnota[7:0].
+ *
+ * Hodnota = (frekvencia − 76,00 MHz) / 50 kHz (0–639 pokryje 76–108 MHz
+ * pri každom rozstupe), @ref PRESET_EMPTY = prázdna predvoľba.
+ *
+ * Pri štarte sa najnovší záznam každého kruhu nájde binárnym
+ * vyhľadávaním nad poradovými číslami – spolu ~130 prečítaných bajtov
+ * namiesto celého 1 KB.
+ */
+
+/** @brief Počet predvolieb. */
+#ifndef PRESET_SLOTS
+# define PRESET_SLOTS 16
+#endif
+
+/** @brief Prvá adresa EEPROM, ktorú banka používa. */
+#ifndef PRESET_EEPROM_BASE
+# define PRESET_EEPROM_BASE 0
+#endif
+
+/** @brief Veľkosť jedného záznamu v bajtoch. */
+#define PRESET_RECORD_SIZE 3
+
+/** @brief Počet záznamov v kruhu jednej predvoľby (1 KB / 16 / 3 = 21). */
+#define PRESET_RING ((E2END + 1 - PRESET_EEPROM_BASE) / (PRESET_SLOTS * PRESET_RECORD_SIZE))
+
+/** @brief Hodnota záznamu pre prázdnu predvoľbu. */
+#define PRESET_EMPTY 0x3FF
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Načíta banku predvolieb z EEPROM do RAM.
+ *
+ * Volať raz pri štarte. Poškodené alebo nikdy nezapísané predvoľby sú prázdne.
+ */
+void preset_init(void);
+
+/**
+ * @brief Vráti frekvenciu predvoľby.
+ *
+ * @param slot Číslo predvoľby 0 až @ref PRESET_SLOTS − 1.
+ * @return Frekvencia v jednotkách ovládača Si4703 (10 kHz) alebo 0, ak je prázdna.
+ */
+int preset_get(uint8_t slot);
+
+/**
+ * @brief Uloží frekvenciu do predvoľby (jeden 3-bajtový zápis, ~10 ms).
+ *
+ * @param slot Číslo predvoľby.
+ * @param freq Frekvencia v jednotkách ovládača Si4703; 0 predvoľbu vymaže.
+ */
+void preset_save(uint8_t slot, int freq);
+
+/**
+ * @brief Nájde predvoľbu s danou frekvenciou.
+ *
+ * @param freq Frekvencia v jednotkách ovládača Si4703; 0 nájde prvú prázdnu predvoľbu.
+ * @return Číslo predvoľby alebo −1.
+ */
+int8_t preset_find(int freq);
+
+/**
+ * @brief Nájde ďalšiu obsadenú predvoľbu za @p slot (cyklicky, vrátane @p slot).
+ *
+ * @param slot Posledná použitá predvoľba.
+ * @return Číslo predvoľby alebo −1, ak sú všetky prázdne.
+ */
+int8_t preset_next(uint8_t slot);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
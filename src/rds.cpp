@@ -0,0 +1,270 @@
+#include "rds.h"
+
+/**
+ * @file
+ * @brief Implementácia dekodéra RDS skupín (0A/0B, 2A/2B, 4A).
+ */
+
+/**
+ * @brief Prevedie RDS znak na zobraziteľný ASCII znak.
+ *
+ * Znaky mimo rozsahu 0x20–0x7E (národné znaky RDS tabuľky) sa nahradia medzerou.
+ *
+ * @param c Znak z RDS bloku.
+ * @return Zobraziteľný znak.
+ */
+static char rds_char(uint8_t c)
+{
+    return (c >= 0x20 && c <= 0x7E) ? (char)c : ' ';
+}
+
+/**
+ * @brief Konštruktor – pripraví prázdny dekodér.
+ */
+RdsDecoder::RdsDecoder()
+{
+    reset();
+}
+
+/**
+ * @brief Zmaže všetky dekódované údaje.
+ *
+ * PS aj RadioText sa vyplnia medzerami, čas a PI sa označia ako neznáme.
+ * Volá sa po každom preladení alebo pri zmene PI kódu.
+ */
+void RdsDecoder::reset()
+{
+    _pi      = 0;
+    _pty     = 0;
+    _flags   = 0;
+    _changed = RDS_CHANGED_PI | RDS_CHANGED_PTY | RDS_CHANGED_PS | RDS_CHANGED_RT;
+    _psValid = 0;
+
+    for (uint8_t i = 0; i < RDS_PS_LEN; i++) {
+        _ps[i]    = ' ';
+        _psTmp[i] = 0;
+    }
+    _ps[RDS_PS_LEN] = '\0';
+
+    for (uint8_t i = 0; i < RDS_RT_LEN; i++) _rt[i] = ' ';
+    _rt[RDS_RT_LEN] = '\0';
+}
+
+/**
+ * @brief Spracuje jednu RDS skupinu.
+ *
+ * Postup:
+ * - blok A (PI) sa prijme len pri BLER ≤ @ref RDS_BLER_MAX_A; zmena PI
+ *   znamená inú stanicu a dekodér sa vynuluje,
+ * - bez platného bloku B sa skupina zahodí (nepoznáme jej typ),
+ * - PTY a TP sa aktualizujú z každej skupiny,
+ * - ďalej sa spracujú len skupiny 0A/0B (PS, TA), 2A/2B (RadioText)
+ *   a 4A (čas); ostatné typy skončia hneď po bloku B.
+ *
+ * @param blocks Bloky A, B, C, D.
+ * @param bler   Úrovne chýb zbalené ako A[7:6] B[5:4] C[3:2] D[1:0].
+ */
+void RdsDecoder::decode(const uint16_t blocks[4], uint8_t bler)
+{
+    uint8_t blerA = (bler >> 6) & 0x03;
+    uint8_t blerB = (bler >> 4) & 0x03;
+    bool    cOk   = ((bler >> 2) & 0x03) <= RDS_BLER_MAX_CD;
+    bool    dOk   = (bler & 0x03) <= RDS_BLER_MAX_CD;
+
+    // Blok A – PI kód
+    if (blerA <= RDS_BLER_MAX_A && blocks[0] != _pi) {
+        if (_pi != 0) reset();          // iná stanica – staré údaje neplatia
+        _pi = blocks[0];
+        _changed |= RDS_CHANGED_PI;
+    }
+
+    // Blok B – bez neho nevieme typ skupiny
+    if (blerB > RDS_BLER_MAX_B) return;
+
+    uint16_t b     = blocks[1];
+    uint8_t  group = b >> 12;           // typ skupiny 0–15
+    bool     verB  = b & 0x0800;        // verzia B
+    uint8_t  pty   = (b >> 5) & 0x1F;
+    uint8_t  flags = (_flags & ~F_TP) | ((b & 0x0400) ? F_TP : 0);
+
+    if (pty != _pty || flags != _flags) {
+        _pty   = pty;
+        _flags = flags;
+        _changed |= RDS_CHANGED_PTY;
+    }
+
+    switch (group) {
+    case 0:     // 0A/0B – Program Service + TA
+        flags = (_flags & ~F_TA) | ((b & 0x0010) ? F_TA : 0);
+        if (flags != _flags) {
+            _flags = flags;
+            _changed |= RDS_CHANGED_PTY;
+        }
+        if (dOk) decodePS(b & 0x03, blocks[3]);
+        break;
+
+    case 2:     // 2A/2B – RadioText
+        if (dOk) decodeRT(verB, b & 0x0F, b & 0x0010, blocks[2], blocks[3], cOk);
+        break;
+
+    case 4:     // 4A – Clock Time (čas musí byť presný, berieme len opravené bloky)
+        if (!verB && ((bler >> 2) & 0x03) <= RDS_BLER_1_2 && (bler & 0x03) <= RDS_BLER_1_2)
+            decodeCT(b, blocks[2], blocks[3]);
+        break;
+
+    default:    // ostatné typy nepoužívame
+        break;
+    }
+}
+
+/**
+ * @brief Spracuje segment názvu stanice (2 znaky z bloku D).
+ *
+ * Segment sa zobrazí až keď je dvakrát za sebou prijatý rovnaký,
+ * čo odfiltruje chyby, ktoré korekcia neodhalila.
+ *
+ * @param seg Číslo segmentu 0–3.
+ * @param d   Blok D so znakmi.
+ */
+void RdsDecoder::decodePS(uint8_t seg, uint16_t d)
+{
+    uint8_t i  = seg * 2;
+    char    c0 = rds_char(d >> 8);
+    char    c1 = rds_char(d & 0xFF);
+
+    if (_psTmp[i] != c0 || _psTmp[i + 1] != c1) {
+        // Prvý príjem – len zapamätáme a čakáme na potvrdenie
+        _psTmp[i]     = c0;
+        _psTmp[i + 1] = c1;
+        return;
+    }
+
+    // Potvrdené dvoma rovnakými príjmami
+    if (_ps[i] != c0 || _ps[i + 1] != c1 || !(_psValid & (1 << seg))) {
+        _ps[i]     = c0;
+        _ps[i + 1] = c1;
+        _changed |= RDS_CHANGED_PS;
+    }
+    _psValid |= (1 << seg);
+}
+
+/**
+ * @brief Spracuje segment RadioTextu.
+ *
+ * - 2A: 4 znaky v blokoch C a D, 16 segmentov → 64 znakov,
+ * - 2B: 2 znaky v bloku D, 16 segmentov → 32 znakov.
+ *
+ * Zmena A/B príznaku znamená nový text – starý sa zmaže.
+ * Znak 0x0D ukončuje text.
+ *
+ * @param typeB true pre skupinu 2B.
+ * @param seg   Číslo segmentu 0–15.
+ * @param ab    A/B príznak textu.
+ * @param c     Blok C.
+ * @param d     Blok D.
+ * @param cOk   Blok C prešiel prahom chýb.
+ */
+void RdsDecoder::decodeRT(bool typeB, uint8_t seg, bool ab, uint16_t c, uint16_t d, bool cOk)
+{
+    uint8_t abFlag = ab ? F_RT_AB : 0;
+
+    if (!(_flags & F_RT_OK) || (_flags & F_RT_AB) != abFlag) {
+        // Nový text – vymazanie starého
+        for (uint8_t i = 0; i < RDS_RT_LEN; i++) _rt[i] = ' ';
+        _rt[RDS_RT_LEN] = '\0';
+        _flags = (_flags & ~F_RT_AB) | abFlag | F_RT_OK;
+        _changed |= RDS_CHANGED_RT;
+    }
+
+    uint8_t raw[4];
+    uint8_t n = 0;
+    uint8_t pos;
+
+    if (typeB) {
+        pos = seg * 2;
+    } else {
+        pos = seg * 4;
+        if (!cOk) {
+            pos += 2;                   // znaky z C preskočíme
+        } else {
+            raw[n++] = c >> 8;
+            raw[n++] = c & 0xFF;
+        }
+    }
+    raw[n++] = d >> 8;
+    raw[n++] = d & 0xFF;
+
+    for (uint8_t i = 0; i < n; i++, pos++) {
+        char ch = (raw[i] == 0x0D) ? '\0' : rds_char(raw[i]);
+        if (_rt[pos] != ch) {
+            _rt[pos] = ch;
+            _changed |= RDS_CHANGED_RT;
+        }
+        if (ch == '\0') break;          // koniec textu
+    }
+}
+
+/**
+ * @brief Dekóduje čas zo skupiny 4A.
+ *
+ * Dátum je zakódovaný ako modifikovaný juliánsky dátum (MJD); prevod na
+ * rok/mesiac/deň používa vzorec z EN 50067 (príloha G) v celočíselnej
+ * aritmetike (bez float na AVR).
+ *
+ * @param b Blok B (MJD bity 16–15).
+ * @param c Blok C (MJD bity 14–0, hodina bit 4).
+ * @param d Blok D (hodina bity 3–0, minúta, lokálny posun).
+ */
+void RdsDecoder::decodeCT(uint16_t b, uint16_t c, uint16_t d)
+{
+    uint32_t mjd    = ((uint32_t)(b & 0x03) << 15) | (c >> 1);
+    uint8_t  hour   = ((c & 0x01) << 4) | (d >> 12);
+    uint8_t  minute = (d >> 6) & 0x3F;
+    int8_t   offset = d & 0x1F;
+
+    if (d & 0x0020) offset = -offset;
+    if (hour > 23 || minute > 59 || mjd < 51544) return;   // pred rokom 2000 = nezmysel
+
+    // Y' = int((MJD - 15078.2) / 365.25)
+    uint32_t yp = (mjd * 100 - 1507820) / 36525;
+    uint32_t yd = yp * 36525 / 100;
+    // M' = int((MJD - 14956.1 - int(Y' * 365.25)) / 30.6001)
+    uint32_t mp = ((mjd - yd) * 10000 - 149561000UL) / 306001;
+    uint8_t  day = mjd - 14956 - yd - (mp * 306001 / 10000);
+    uint8_t  k   = (mp == 14 || mp == 15) ? 1 : 0;
+
+    _time.year   = yp + k - 100;
+    _time.month  = mp - 1 - k * 12;
+    _time.day    = day;
+    _time.hour   = hour;
+    _time.minute = minute;
+    _time.offset = offset;
+
+    _flags   |= F_CT_OK;
+    _changed |= RDS_CHANGED_CT;
+}
+
+/**
+ * @brief Vráti a vynuluje príznaky zmien.
+ *
+ * @return Kombinácia RDS_CHANGED_* od posledného volania.
+ */
+uint8_t RdsDecoder::takeChanges()
+{
+    uint8_t changed = _changed;
+    _changed = 0;
+    return changed;
+}
+
+/**
+ * @brief Skopíruje posledný prijatý čas.
+ *
+ * @param t Cieľová štruktúra.
+ * @return true ak už bol prijatý platný čas (skupina 4A).
+ */
+bool RdsDecoder::getTime(rdsTime_t *t) const
+{
+    if (!(_flags & F_CT_OK)) return false;
+    *t = _time;
+    return true;
+}
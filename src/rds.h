@@ -0,0 +1,142 @@
+#ifndef RDS_H
+#define RDS_H
+
+#include <stdint.h>
+
+/**
+ * @file
+ * @brief Dekodér RDS skupín (PI, PTY, TP/TA, PS, RadioText, CT).
+ *
+ * Dekodér spracúva jednu RDS skupinu (4 bloky po 16 bitoch) naraz spolu
+ * s úrovňou chýb jednotlivých blokov (BLERA–BLERD zo Si4703 vo verbose režime).
+ *
+ * Vlastnosti:
+ * - pevná pamäť (žiadna dynamická alokácia), spolu pod 100 bajtov SRAM,
+ * - bloky s príliš veľa chybami sa zahodia (prahy @ref RDS_BLER_MAX_B a pod.),
+ * - segmenty PS sa zobrazia až po dvoch rovnakých príjmoch za sebou,
+ * - nepoužívané typy skupín sa zahodia hneď po dekódovaní bloku B.
+ *
+ * Modul nezávisí od AVR hlavičiek, takže sa dá preložiť aj na PC
+ * a otestovať nad zaznamenanými RDS dátami.
+ */
+
+/**
+ * @name Úroveň chýb bloku (BLER)
+ * @{
+ */
+#define RDS_BLER_NONE     0   /**< @brief Blok bez chýb. */
+#define RDS_BLER_1_2      1   /**< @brief 1–2 opravené chyby. */
+#define RDS_BLER_3_5      2   /**< @brief 3–5 opravených chýb. */
+#define RDS_BLER_FAIL     3   /**< @brief 6+ chýb – neopraviteľný blok. */
+/** @} */
+
+/**
+ * @name Prahy prijatia blokov
+ * @brief Blok sa použije len ak jeho BLER ≤ prah.
+ * @{
+ */
+#define RDS_BLER_MAX_A    RDS_BLER_1_2  /**< @brief Blok A (PI). */
+#define RDS_BLER_MAX_B    RDS_BLER_1_2  /**< @brief Blok B (typ skupiny, PTY, adresy segmentov). */
+#define RDS_BLER_MAX_CD   RDS_BLER_3_5  /**< @brief Bloky C a D (text, čas). */
+/** @} */
+
+/**
+ * @name Príznaky zmien
+ * @brief Bity vracané metódou RdsDecoder::takeChanges().
+ * @{
+ */
+#define RDS_CHANGED_PI    0x01  /**< @brief Zmenil sa PI kód (iná stanica). */
+#define RDS_CHANGED_PTY   0x02  /**< @brief Zmenil sa PTY, TP alebo TA. */
+#define RDS_CHANGED_PS    0x04  /**< @brief Potvrdený nový segment PS. */
+#define RDS_CHANGED_RT    0x08  /**< @brief Zmenil sa RadioText. */
+#define RDS_CHANGED_CT    0x10  /**< @brief Prijatý nový čas (CT). */
+/** @} */
+
+/** @brief Dĺžka názvu stanice (Program Service). */
+#define RDS_PS_LEN        8
+/** @brief Maximálna dĺžka RadioTextu (skupina 2A). */
+#define RDS_RT_LEN        64
+
+/**
+ * @brief Čas a dátum zo skupiny 4A (Clock Time).
+ */
+struct rdsTime_t {
+    uint8_t year;       ///< Rok od 2000 (UTC).
+    uint8_t month;      ///< Mesiac 1–12 (UTC).
+    uint8_t day;        ///< Deň 1–31 (UTC).
+    uint8_t hour;       ///< Hodina 0–23 (UTC).
+    uint8_t minute;     ///< Minúta 0–59.
+    int8_t  offset;     ///< Lokálny posun v polhodinách (so znamienkom).
+};
+
+/**
+ * @class RdsDecoder
+ * @brief Stavový dekodér RDS skupín s pevnou pamäťou.
+ *
+ * Typické použitie:
+ * - po každom preladení zavolať @ref reset,
+ * - každú prijatú skupinu odovzdať do @ref decode,
+ * - podľa @ref takeChanges prekresliť príslušné časti UI.
+ */
+class RdsDecoder {
+public:
+    /// Vytvorí prázdny dekodér.
+    RdsDecoder();
+
+    /// Zmaže všetky dekódované údaje (napr. po preladení).
+    void reset();
+
+    /**
+     * @brief Spracuje jednu RDS skupinu.
+     *
+     * @param blocks Bloky A, B, C, D (RDSA–RDSD).
+     * @param bler   Úrovne chýb blokov zbalené ako A[7:6] B[5:4] C[3:2] D[1:0].
+     */
+    void decode(const uint16_t blocks[4], uint8_t bler);
+
+    /// Vráti a vynuluje príznaky zmien (RDS_CHANGED_*).
+    uint8_t takeChanges();
+
+    /// PI kód stanice (0 = zatiaľ neznámy).
+    uint16_t getPI() const { return _pi; }
+    /// Typ programu (PTY 0–31).
+    uint8_t getPTY() const { return _pty; }
+    /// Traffic Program príznak.
+    bool getTP() const { return _flags & F_TP; }
+    /// Traffic Announcement príznak (zo skupiny 0A/0B).
+    bool getTA() const { return _flags & F_TA; }
+
+    /// Názov stanice (8 znakov + '\0'); nepotvrdené segmenty sú medzery.
+    const char *getPS() const { return _ps; }
+    /// Zistí, či sú všetky štyri segmenty PS potvrdené.
+    bool psComplete() const { return _psValid == 0x0F; }
+
+    /// RadioText ukončený '\0' (nepríjaté segmenty sú medzery).
+    const char *getRT() const { return _rt; }
+
+    /// Zistí, či bol prijatý čas; ak áno, skopíruje ho do @p t.
+    bool getTime(rdsTime_t *t) const;
+
+private:
+    static const uint8_t F_TP    = 0x01;   ///< TP bit.
+    static const uint8_t F_TA    = 0x02;   ///< TA bit.
+    static const uint8_t F_RT_AB = 0x04;   ///< Posledný A/B príznak RadioTextu.
+    static const uint8_t F_RT_OK = 0x08;   ///< A/B príznak už bol prijatý.
+    static const uint8_t F_CT_OK = 0x10;   ///< Čas je platný.
+
+    void decodePS(uint8_t seg, uint16_t d);
+    void decodeRT(bool typeB, uint8_t seg, bool ab, uint16_t c, uint16_t d, bool cOk);
+    void decodeCT(uint16_t b, uint16_t c, uint16_t d);
+
+    uint16_t  _pi;                  ///< PI kód.
+    uint8_t   _pty;                 ///< Typ programu.
+    uint8_t   _flags;               ///< Príznaky F_*.
+    uint8_t   _changed;             ///< Nespracované zmeny RDS_CHANGED_*.
+    uint8_t   _psValid;             ///< Maska potvrdených segmentov PS.
+    char      _ps[RDS_PS_LEN + 1];  ///< Potvrdený PS.
+    char      _psTmp[RDS_PS_LEN];   ///< Posledný prijatý (nepotvrdený) PS.
+    char      _rt[RDS_RT_LEN + 1];  ///< RadioText.
+    rdsTime_t _time;                ///< Posledný prijatý čas.
+};
+
+#endif
@@ -0,0 +1,213 @@
+#include "screen.h"
+#include "oled.h"
+#include "button_function.h"
+#include "Si4703.h"
+#include "rds.h"
+
+/**
+ * @file
+ * @brief Implementácia modelu hlavnej obrazovky a obmedzovača snímok.
+ */
+
+/// Globálny objekt FM rádia (definovaný v Si4703.cpp).
+extern Si4703 radio;
+
+/// Čas v ms od štartu (implementovaný v main.cpp).
+extern unsigned long timer_millis();
+
+/// Čas od štartu v tikoch Timer0 po 4 µs (implementovaný v main.cpp).
+extern uint32_t timer_ticks(void);
+
+/**
+ * @name Prvky obrazovky (bity masky zmien)
+ * @{
+ */
+#define SCREEN_HEADER 0x01  ///< Hlavička – zapnutie, mute.
+#define SCREEN_MODE   0x02  ///< Režim enkódera.
+#define SCREEN_FREQ   0x04  ///< Frekvencia.
+#define SCREEN_VOLUME 0x08  ///< Hlasitosť.
+#define SCREEN_RSSI   0x10  ///< Úroveň signálu.
+#define SCREEN_TOAST  0x20  ///< Hláška v spodnom riadku.
+#define SCREEN_TEXT   0x40  ///< RDS RadioText (bežiaci riadok).
+#define SCREEN_ALL    0x7F
+/** @} */
+
+/**
+ * @brief Hodnoty, z ktorých sa kreslí obrazovka.
+ */
+typedef struct {
+    int     freq;   ///< Frekvencia (10 kHz).
+    uint8_t volume; ///< Hlasitosť.
+    uint8_t rssi;   ///< RSSI.
+    bool    muted;  ///< Zvuk stlmený.
+    bool    tune;   ///< Enkóder ladí (inak mení hlasitosť).
+    bool    on;     ///< Rádio zapnuté.
+} screen_model_t;
+
+/// Naposledy zobrazený stav.
+static screen_model_t s_shown;
+/// Prvky, ktoré sa prekreslia v ďalšej snímke bez ohľadu na zmenu.
+static uint8_t s_dirty = SCREEN_ALL;
+/// Čas poslednej snímky (ms).
+static unsigned long s_frame_ms = 0;
+/// Štatistika snímok.
+static screen_stats_t s_stats;
+
+/// Aktuálna hláška ("" = žiadna).
+static char s_toast[SCREEN_TOAST_LEN + 1];
+/// Čas (ms), keď hláška zmizne; platí len pri @c s_toast_timed.
+static unsigned long s_toast_until;
+static bool s_toast_timed;
+
+/**
+ * @brief Vymaže displej a označí všetky prvky na prekreslenie.
+ */
+void screen_init(void)
+{
+    oled_clear();
+    s_dirty = SCREEN_ALL;
+}
+
+/**
+ * @brief Označí všetky prvky na prekreslenie v ďalšej snímke.
+ */
+void screen_invalidate(void)
+{
+    s_dirty = SCREEN_ALL;
+}
+
+/**
+ * @brief Zobrazí krátku hlášku v spodnom riadku (v najbližšej snímke).
+ */
+void screen_toast(const char *text, uint16_t ms)
+{
+    uint8_t i = 0;
+
+    for (; i < SCREEN_TOAST_LEN && text[i]; i++) s_toast[i] = text[i];
+    s_toast[i] = '\0';
+
+    s_toast_until = timer_millis() + ms;
+    s_toast_timed = (ms != 0);
+    s_dirty |= SCREEN_TOAST;
+}
+
+/**
+ * @brief Zmaže hlášku v najbližšej snímke.
+ */
+void screen_toast_clear(void)
+{
+    if (!s_toast[0]) return;
+    s_toast[0] = '\0';
+    s_dirty |= SCREEN_TOAST;
+}
+
+/**
+ * @brief Prečíta aktuálny stav rádia do @p m.
+ *
+ * Pri vypnutom rádiu sa tuner nečíta – hodnoty ostanú posledné zobrazené.
+ */
+static void screen_sample(screen_model_t *m)
+{
+    m->on   = radio_ui_is_on();
+    m->tune = (radio_ui_get_mode() == RADIO_MODE_TUNE);
+    if (!m->on) return;
+
+    m->freq   = radio.getChannel();
+    m->rssi   = radio.getRSSI();
+    m->volume = radio.getVolume();
+    m->muted  = !radio.getMute();           // DMUTE = 1 → zvuk zapnutý
+}
+
+/**
+ * @brief Nasýtené pretypovanie na 16 bitov pre štatistiku.
+ */
+static uint16_t screen_sat16(uint32_t v)
+{
+    return (v > 0xFFFF) ? 0xFFFF : (uint16_t)v;
+}
+
+/**
+ * @brief Snímka displeja, ak uplynula perióda @ref SCREEN_FRAME_MS.
+ *
+ * Zmenené prvky sa prekreslia v poradí hlavička, režim, frekvencia,
+ * hlasitosť, RSSI, hláška (zmaže sa aj tu, keď jej vyprší čas),
+ * RadioText (@ref oled_ticker_text) a doplnenie bežiaceho riadku; na bufferovaných stránkach (@ref OLED_FB_PAGES)
+ * pošle každý prvok len stĺpce, ktoré sa zmenili.
+ *
+ * @return @c true ak sa niečo prekreslilo.
+ */
+bool screen_poll(void)
+{
+    unsigned long now = timer_millis();
+    unsigned long dt  = now - s_frame_ms;
+
+    if (dt < SCREEN_FRAME_MS) return false;
+    if (s_frame_ms && dt >= 2 * SCREEN_FRAME_MS)
+        s_stats.skipped = screen_sat16(s_stats.skipped + dt / SCREEN_FRAME_MS - 1);
+    s_frame_ms = now;
+
+    screen_model_t m = s_shown;
+    uint8_t dirty = s_dirty;
+
+    screen_sample(&m);
+    if (m.on != s_shown.on)         dirty |= SCREEN_HEADER | SCREEN_MODE | SCREEN_TEXT;
+    if (m.muted != s_shown.muted)   dirty |= SCREEN_HEADER;
+    if (m.tune != s_shown.tune)     dirty |= SCREEN_MODE;
+    if (m.freq != s_shown.freq)     dirty |= SCREEN_FREQ;
+    if (m.volume != s_shown.volume) dirty |= SCREEN_VOLUME;
+    if (m.rssi != s_shown.rssi)     dirty |= SCREEN_RSSI;
+    if (m.on && (radio.getRDS().takeChanges() & (RDS_CHANGED_RT | RDS_CHANGED_PI)))
+        dirty |= SCREEN_TEXT;
+    s_shown = m;
+    s_dirty = 0;
+
+    if (s_toast[0] && s_toast_timed && (long)(now - s_toast_until) >= 0) {
+        s_toast[0] = '\0';                  // čas hlášky vypršal
+        dirty |= SCREEN_TOAST;
+    }
+
+    uint32_t b0, b1;
+    uint16_t x;
+    uint32_t t0 = timer_ticks();
+
+    oled_get_bus_stats(&b0, &x);
+    if (dirty & SCREEN_HEADER)              oled_show_header(m.on, m.muted);
+    if ((dirty & SCREEN_MODE) && m.on)      oled_show_mode(m.tune);   // pri vypnutí ho prekryje hlavička
+    if (dirty & SCREEN_FREQ)                oled_show_freq(m.freq);
+    if (dirty & SCREEN_VOLUME)              oled_show_volume(m.volume);
+    if (dirty & SCREEN_RSSI)                oled_show_rssi(m.rssi);
+    if (dirty & SCREEN_TOAST)               oled_show_toast(s_toast);
+    if (dirty & SCREEN_TEXT)                oled_ticker_text(m.on ? radio.getRDS().getRT() : "");
+    oled_ticker_poll();                     // stĺpce, ktoré posun priniesol na pravý okraj
+    oled_get_bus_stats(&b1, &x);
+
+    if (b1 == b0) {
+        if (s_stats.idle < 0xFFFF) s_stats.idle++;
+        return false;
+    }
+
+    s_stats.time_last  = screen_sat16((timer_ticks() - t0) * 4);      // tik = 4 µs
+    s_stats.bytes_last = screen_sat16(b1 - b0);
+    if (s_stats.time_last > s_stats.time_max)   s_stats.time_max  = s_stats.time_last;
+    if (s_stats.bytes_last > s_stats.bytes_max) s_stats.bytes_max = s_stats.bytes_last;
+    if (s_stats.frames < 0xFFFF) s_stats.frames++;
+    return true;
+}
+
+/**
+ * @brief Vráti štatistiku snímok.
+ */
+void screen_get_stats(screen_stats_t *st)
+{
+    *st = s_stats;
+}
+
+/**
+ * @brief Vynuluje štatistiku snímok.
+ */
+void screen_clear_stats(void)
+{
+    screen_stats_t zero = {};
+
+    s_stats = zero;
+}
@@ -0,0 +1,108 @@
+#ifndef SCREEN_H
+#define SCREEN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @file
+ * @brief Model hlavnej obrazovky rádia a obmedzovač snímok displeja.
+ *
+ * Stav, ktorý obrazovka zobrazuje (frekvencia, hlasitosť, RSSI, mute,
+ * režim enkódera, zapnutie), sa drží ako model. @ref screen_poll sa volá
+ * v každej iterácii hlavnej slučky, ale stav číta a kreslí najviac
+ * @ref SCREEN_FPS krát za sekundu – a prekreslí len prvky
+ * (@ref oled_show_header, @ref oled_show_freq, ...), ktorých hodnota
+ * sa od poslednej snímky zmenila. Pri vypnutom rádiu sa tuner nečíta.
+ *
+ * Nezmenená snímka tak nestojí žiadny bajt zbernice a čas CPU ostáva
+ * pre RDS a prechod pásmom.
+ *
+ * Krátke hlášky (@ref screen_toast) sa kreslia tou istou snímkou do
+ * spodného riadku a po uplynutí času zmiznú – hlavná slučka pritom
+ * nečaká. RDS RadioText beží v bežiacom riadku (@ref oled_ticker_text),
+ * ktorý posúva sám displej.
+ */
+
+/** @brief Najvyšší počet snímok displeja za sekundu. */
+#ifndef SCREEN_FPS
+# define SCREEN_FPS 20
+#endif
+
+/** @brief Perióda snímky v ms. */
+#define SCREEN_FRAME_MS (1000 / SCREEN_FPS)
+
+/** @brief Predvolená doba zobrazenia hlášky v ms. */
+#ifndef SCREEN_TOAST_MS
+# define SCREEN_TOAST_MS 3000
+#endif
+
+/** @brief Najdlhšia hláška v znakoch (riadok displeja). */
+#define SCREEN_TOAST_LEN 20
+
+/**
+ * @brief Štatistika snímok od štartu alebo @ref screen_clear_stats.
+ */
+typedef struct {
+    uint16_t frames;     ///< Snímky, v ktorých sa prekreslil aspoň jeden prvok.
+    uint16_t idle;       ///< Snímky bez zmeny (nič sa neposlalo).
+    uint16_t skipped;    ///< Zmeškané periódy – slučka sa k snímke dostala neskoro.
+    uint16_t time_last;  ///< Čas poslednej prekreslenej snímky v µs.
+    uint16_t time_max;   ///< Najdlhšia snímka v µs.
+    uint16_t bytes_last; ///< Bajty zbernice poslednej prekreslenej snímky.
+    uint16_t bytes_max;  ///< Najviac bajtov zbernice za snímku.
+} screen_stats_t;
+
+/**
+ * @brief Vymaže displej a označí všetky prvky na prekreslenie v ďalšej snímke.
+ *
+ * Volať raz po štarte tunera (zmaže aj úvodnú obrazovku).
+ */
+void screen_init(void);
+
+/**
+ * @brief Prekreslí všetky prvky v ďalšej snímke (napr. po zásahu iného kódu do displeja).
+ */
+void screen_invalidate(void);
+
+/**
+ * @brief Zobrazí krátku hlášku v spodnom riadku.
+ *
+ * Hláška sa skopíruje (najviac @ref SCREEN_TOAST_LEN znakov), vykreslí
+ * sa v najbližšej snímke a nahradí predošlú. Po @p ms milisekundách
+ * (podľa @c timer_millis) ju snímka zmaže; @p ms = 0 ju nechá do
+ * @ref screen_toast_clear alebo ďalšej hlášky (napr. „Seeking...“,
+ * „Scan 45%“ počas dlhšej operácie).
+ *
+ * @param text Text hlášky.
+ * @param ms   Doba zobrazenia v ms (0 = bez obmedzenia).
+ */
+void screen_toast(const char *text, uint16_t ms);
+
+/**
+ * @brief Zmaže hlášku v najbližšej snímke.
+ */
+void screen_toast_clear(void);
+
+/**
+ * @brief Snímka displeja, ak uplynula perióda @ref SCREEN_FRAME_MS.
+ *
+ * Prečíta stav rádia, porovná ho so zobrazeným a prekreslí zmenené prvky.
+ *
+ * @return @c true ak sa niečo poslalo na displej.
+ */
+bool screen_poll(void);
+
+/**
+ * @brief Vráti štatistiku snímok.
+ *
+ * @param st Výstup.
+ */
+void screen_get_stats(screen_stats_t *st);
+
+/**
+ * @brief Vynuluje štatistiku snímok.
+ */
+void screen_clear_stats(void);
+
+#endif
@@ -0,0 +1,178 @@
+/**
+ * @file
+ * @brief Implementácia programovej I2C zbernice (master, zápis).
+ *
+ * Fáza hodín = pevné čakanie (__builtin_avr_delay_cycles) mínus takty
+ * inštrukcií slučky, odhadnuté z prekladu avr-gcc -Os: ~10 taktov medzi
+ * zostupnou a nábežnou hranou SCL (slučka, SDA, posun) a ~5 taktov
+ * v jednotke (test SCL, zostupná hrana).
+ */
+
+// -- Includes -------------------------------------------------------
+#include <avr/pgmspace.h>
+#include <swi2c.h>
+
+
+// -- Defines --------------------------------------------------------
+#define SW_DDR (*(&SWI2C_PORT - 1))     /* DDR register portu SWI2C_PORT */
+#define SW_PIN (*(&SWI2C_PORT - 2))     /* PIN register portu SWI2C_PORT */
+
+#define SW_SDA (1<<SWI2C_SDA_PIN)
+#define SW_SCL (1<<SWI2C_SCL_PIN)
+
+/* Otvorený kolektor: výstup = nula, vstup = uvoľnená linka (pull-up) */
+#define sda_low()     SW_DDR |= SW_SDA
+#define sda_release() SW_DDR &= ~SW_SDA
+#define scl_low()     SW_DDR |= SW_SCL
+#define scl_release() SW_DDR &= ~SW_SCL
+
+/* Takty jednej periódy SCL a čakania v nule / jednotke (po odpočítaní réžie) */
+#define SW_CYC      (F_CPU / SWI2C_HZ)
+#define SW_HIGH_CYC (SW_CYC * 2 / 5 - 5)
+#define SW_LOW_CYC  (SW_CYC - SW_CYC * 2 / 5 - 10)
+
+#if SW_CYC < 25
+# error "SWI2C_HZ je pre F_CPU príliš vysoká"
+#endif
+
+#define sw_delay(cyc) __builtin_avr_delay_cycles(cyc)
+
+
+// -- Local functions ------------------------------------------------
+
+/**
+ * @brief Uvoľní SCL a počká, kým slave hodiny nepustí (clock stretching).
+ *
+ * @return 0 = SCL v jednotke, 1 = timeout.
+ */
+static inline uint8_t sw_scl_high(void)
+{
+    uint8_t n = SWI2C_STRETCH_LOOPS;
+
+    scl_release();
+    while (!(SW_PIN & SW_SCL))
+        if (!--n) return 1;
+    return 0;
+}
+
+
+// -- Functions ------------------------------------------------------
+
+/**
+ * @brief Inicializuje piny zbernice a uvoľní ju.
+ */
+void swi2c_init(void)
+{
+    SWI2C_PORT &= ~(SW_SDA | SW_SCL);
+    sda_release();
+    scl_release();
+    sw_delay(SW_LOW_CYC);
+
+    /* Slave drží SDA – dotiahne prerušený bajt hodinami */
+    for (uint8_t i = 0; i < 9 && !(SW_PIN & SW_SDA); i++) {
+        scl_low();
+        sw_delay(SW_LOW_CYC);
+        sw_scl_high();
+        sw_delay(SW_HIGH_CYC);
+    }
+    scl_low();
+    swi2c_stop();
+}
+
+
+/**
+ * @brief Vyšle START a adresový bajt.
+ *
+ * @param sla 8-bitová adresa (7-bitová adresa << 1 | R/W).
+ *
+ * @return @ref SWI2C_OK, @ref SWI2C_NACK_ADDR alebo @ref SWI2C_TIMEOUT.
+ */
+uint8_t swi2c_start(uint8_t sla)
+{
+    sda_low();                                  /* START: SDA ↓ pri SCL = 1 */
+    sw_delay(SW_HIGH_CYC + 5);
+    scl_low();
+
+    uint8_t r = swi2c_write(sla);
+    return (r == 1) ? SWI2C_NACK_ADDR : r;
+}
+
+
+/**
+ * @brief Vyšle jeden bajt (MSB prvý) a prečíta ACK.
+ *
+ * Pri vstupe aj výstupe je SCL v nule.
+ *
+ * @param data Bajt.
+ *
+ * @return 0 = ACK, 1 = NACK, @ref SWI2C_TIMEOUT pri natiahnutých hodinách.
+ */
+uint8_t swi2c_write(uint8_t data)
+{
+    for (uint8_t i = 8; i; i--) {
+        if (data & 0x80) sda_release();
+        else             sda_low();
+        data <<= 1;
+        sw_delay(SW_LOW_CYC);
+        if (sw_scl_high()) return SWI2C_TIMEOUT;
+        sw_delay(SW_HIGH_CYC);
+        scl_low();
+    }
+
+    /* ACK: SDA uvoľní master, nulu drží slave */
+    sda_release();
+    sw_delay(SW_LOW_CYC);
+    if (sw_scl_high()) return SWI2C_TIMEOUT;
+    uint8_t nack = (SW_PIN & SW_SDA) ? 1 : 0;
+    sw_delay(SW_HIGH_CYC);
+    scl_low();
+    return nack;
+}
+
+
+/**
+ * @brief Vyšle STOP (SDA ↑ pri SCL = 1) a uvoľní zbernicu.
+ */
+void swi2c_stop(void)
+{
+    sda_low();
+    sw_delay(SW_LOW_CYC);
+    sw_scl_high();
+    sw_delay(SW_HIGH_CYC);
+    sda_release();
+    sw_delay(SW_LOW_CYC);                       /* t_BUF pred ďalším STARTom */
+}
+
+
+/**
+ * @brief Zapíše bajt @p reg a za ním @p len dátových bajtov v jednej transakcii.
+ *
+ * @param addr  7-bitová adresa.
+ * @param reg   Prvý bajt.
+ * @param buf   Dáta (RAM, PROGMEM pri @ref SWI2C_PGM, jeden bajt pri @ref SWI2C_FILL).
+ * @param len   Počet dátových bajtov.
+ * @param flags @ref SWI2C_PGM, @ref SWI2C_FILL alebo 0.
+ *
+ * @return @ref SWI2C_OK, @ref SWI2C_NACK_ADDR, @ref SWI2C_NACK_DATA alebo @ref SWI2C_TIMEOUT.
+ */
+uint8_t swi2c_write_reg(uint8_t addr, uint8_t reg, const uint8_t *buf, uint8_t len, uint8_t flags)
+{
+    uint8_t status = swi2c_start(addr << 1);
+    uint8_t data   = reg;
+
+    for (uint8_t i = 0; status == SWI2C_OK; i++) {
+        uint8_t r = swi2c_write(data);
+        if (r) {
+            status = (r == 1) ? SWI2C_NACK_DATA : r;
+            break;
+        }
+        if (i == len) break;
+
+        if (flags & SWI2C_FILL)     data = buf[0];
+        else if (flags & SWI2C_PGM) data = pgm_read_byte(&buf[i]);
+        else                        data = buf[i];
+    }
+
+    swi2c_stop();
+    return status;
+}
@@ -0,0 +1,137 @@
+#ifndef SWI2C_H
+# define SWI2C_H
+
+/**
+ * @file
+ * @defgroup swi2c Softvérová I2C zbernica <swi2c.h>
+ * @code #include <swi2c.h> @endcode
+ *
+ * @brief Programový I2C master (len zápis) na samostatných pinoch.
+ *
+ * Druhá I2C zbernica pre zariadenia, ktoré sa nemajú deliť o hardvérové
+ * TWI s tunerom (OLED, @ref OLED_BUS). Piny sa ovládajú ako otvorený
+ * kolektor – PORT ostáva 0, nula sa vysiela nastavením DDR na výstup,
+ * jednotka uvoľnením linky (externé pull-up rezistory sú nutné).
+ *
+ * Časovanie je počítané v taktoch pri preklade (@ref SWI2C_HZ), SCL
+ * je v nule ~60 % a v jednotke ~40 % periódy, čo pri 400 kHz spĺňa
+ * t_LOW ≥ 1,3 µs a t_HIGH ≥ 0,6 µs. Prerušenie počas prenosu len
+ * predĺži aktuálnu fázu hodín, takže TWI prerušenia tunera môžu bežať
+ * súbežne. Slave môže hodiny natiahnuť najviac o @ref SWI2C_STRETCH_LOOPS
+ * čakacích slučiek.
+ * @{
+ */
+
+// -- Includes -------------------------------------------------------
+#include <avr/io.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// -- Defines --------------------------------------------------------
+/** @brief Port pinov softvérovej zbernice (SDA aj SCL na rovnakom porte). */
+#ifndef SWI2C_PORT
+# define SWI2C_PORT PORTC
+#endif
+
+/** @brief Pin SDA (predvolene PC3 / A3). */
+#ifndef SWI2C_SDA_PIN
+# define SWI2C_SDA_PIN 3
+#endif
+
+/** @brief Pin SCL (predvolene PC0 / A0). */
+#ifndef SWI2C_SCL_PIN
+# define SWI2C_SCL_PIN 0
+#endif
+
+/** @brief Rýchlosť SCL v Hz (pevná pri preklade). */
+#ifndef SWI2C_HZ
+# define SWI2C_HZ 400000UL
+#endif
+
+/** @brief Najviac čakacích slučiek na uvoľnenie SCL slave zariadením (~4 takty/slučka). */
+#define SWI2C_STRETCH_LOOPS 250
+
+/**
+ * @name Príznaky @ref swi2c_write_reg
+ * @{
+ */
+/** @brief Dáta ležia vo flash pamäti (PROGMEM). */
+#define SWI2C_PGM 0x04
+/** @brief Opakuje sa jeden bajt @c buf[0] (@c len krát). */
+#define SWI2C_FILL 0x08
+/** @} */
+
+/**
+ * @name Stav prenosu (rovnaké hodnoty ako TWI_XF_* v twi.h)
+ * @{
+ */
+/** @brief Prenos prebehol. */
+#define SWI2C_OK 0
+/** @brief Slave nepotvrdil adresu. */
+#define SWI2C_NACK_ADDR 1
+/** @brief Slave nepotvrdil dátový bajt. */
+#define SWI2C_NACK_DATA 2
+/** @brief SCL ostala v nule dlhšie ako @ref SWI2C_STRETCH_LOOPS. */
+#define SWI2C_TIMEOUT 5
+/** @} */
+
+
+// -- Function prototypes --------------------------------------------
+
+/**
+ * @brief Inicializuje piny zbernice a uvoľní ju.
+ *
+ * Ak slave drží SDA v nule (prerušený prenos), vyšle až 9 hodín a STOP.
+ */
+void swi2c_init(void);
+
+
+/**
+ * @brief Vyšle START a adresový bajt.
+ *
+ * @param sla 8-bitová adresa (7-bitová adresa << 1 | R/W).
+ *
+ * @return @ref SWI2C_OK, @ref SWI2C_NACK_ADDR alebo @ref SWI2C_TIMEOUT.
+ */
+uint8_t swi2c_start(uint8_t sla);
+
+
+/**
+ * @brief Vyšle jeden bajt.
+ *
+ * @param data Bajt.
+ *
+ * @return 0 = ACK, 1 = NACK, @ref SWI2C_TIMEOUT pri natiahnutých hodinách.
+ */
+uint8_t swi2c_write(uint8_t data);
+
+
+/**
+ * @brief Vyšle STOP a uvoľní zbernicu.
+ */
+void swi2c_stop(void);
+
+
+/**
+ * @brief Zapíše bajt @p reg a za ním @p len dátových bajtov v jednej transakcii.
+ *
+ * @param addr  7-bitová adresa.
+ * @param reg   Prvý bajt (napr. riadiaci bajt SSD1306).
+ * @param buf   Dáta v RAM, vo flash pri @ref SWI2C_PGM, jeden bajt pri @ref SWI2C_FILL.
+ * @param len   Počet dátových bajtov.
+ * @param flags @ref SWI2C_PGM, @ref SWI2C_FILL alebo 0.
+ *
+ * @return @ref SWI2C_OK, @ref SWI2C_NACK_ADDR, @ref SWI2C_NACK_DATA alebo @ref SWI2C_TIMEOUT.
+ */
+uint8_t swi2c_write_reg(uint8_t addr, uint8_t reg, const uint8_t *buf, uint8_t len, uint8_t flags);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
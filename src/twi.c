@@ -16,7 +16,20 @@
  *  - generovanie START/STOP podmienok,
  *  - zápis a čítanie jedného bajtu,
  *  - test prítomnosti zariadenia na zbernici,
- *  - čítanie bloku dát z pamäte periférie.
+ *  - čítanie bloku dát z pamäte periférie,
+ *  - frontu transakcií obsluhovanú v prerušení TWI_vect,
+ *  - ohraničené čakanie, obnovu zaseknutej zbernice a počítadlá chýb.
+ *
+ * Bajtové funkcie (twi_start … twi_stop) a fronta sa o zbernicu delia:
+ * twi_start počká na dokončenie fronty, twi_stop spustí transakcie,
+ * ktoré medzitým pribudli.
+ *
+ * Žiadne čakanie na TWI nie je nekonečné: bajtové funkcie čakajú na TWINT
+ * najviac @ref TWI_TIMEOUT_US, čakacie slučky fronty sledujú, či bežiaca
+ * transakcia napreduje. Pri prekročení sa zbernica obnoví (@ref twi_recover)
+ * a transakcia skončí stavom @ref TWI_XF_TIMEOUT.
+ * V ISR sa zbernica neobnovuje: STOP, ktorý neodíde, transakciu len
+ * ukončí a fronta stojí, kým ju neobnoví čakacia slučka alebo twi_submit.
  *
  * Funkcie používajú vnútorný TWI modul mikrokontroléra a predpokladajú
  * vhodne nastavené konštanty F_CPU, F_SCL a TWI_BIT_RATE_REG (pozri twi.h).
@@ -24,6 +37,616 @@
 
 // -- Includes -------------------------------------------------------
 #include <twi.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <util/delay.h>
+
+
+// -- Defines --------------------------------------------------------
+/* Interný stav: pokračovanie rozdelenej transakcie (nemeria sa čakanie) */
+#define TWI_XF_SPLIT 0x40
+
+/* Trieda priority transakcie */
+#define TWI_PRIO(x) (((x)->flags & TWI_XF_LOW) ? TWI_PRIO_LOW : TWI_PRIO_HIGH)
+
+/* TWCR pre ďalší krok transakcie z fronty (prerušenie povolené) */
+#define TWI_CR_NEXT ((1<<TWINT) | (1<<TWEN) | (1<<TWIE))
+
+/* Polperióda SCL pri obnove zbernice (~100 kHz) */
+#define TWI_RECOVER_US 5
+
+#if TWI_TRACE
+# if (TWI_TRACE_SIZE & (TWI_TRACE_SIZE - 1)) != 0
+#  error "TWI_TRACE_SIZE musí byť mocnina 2"
+# endif
+# define TWI_TRACE_MASK (TWI_TRACE_SIZE - 1)
+# define TWI_TRACE_BEGIN()                  twi_trace_begin()
+# define TWI_TRACE_END(addr, dir, n, st)    twi_trace_end(addr, dir, n, st)
+#else
+# define TWI_TRACE_BEGIN()                  do {} while (0)
+# define TWI_TRACE_END(addr, dir, n, st)    do {} while (0)
+#endif
+
+
+// -- Types ----------------------------------------------------------
+/* Zariadenie s vlastnou rýchlosťou a počítadlami chýb */
+typedef struct {
+    uint8_t addr;                       /* 7-bitová adresa (0 = voľný slot) */
+    uint8_t twbr;                       /* TWBR pre zariadenie */
+    uint8_t twps;                       /* pred-deľič (TWPS1:0) pre zariadenie */
+    twi_errors_t err;                   /* počítadlá chýb */
+} twi_dev_t;
+
+#if TWI_TRACE
+/* Záznam tracera (formát pozri twi.h) */
+typedef struct {
+    uint8_t  addr;                      /* 7-bitová adresa */
+    uint8_t  info;                      /* smer << 6 | stav TWI_XF_* */
+    uint8_t  count;                     /* počet prenesených bajtov */
+    uint32_t start;                     /* začiatok v tikoch twi_trace_clock */
+    uint16_t dur;                       /* trvanie v tikoch */
+} twi_trace_t;
+#endif
+
+/* Stav strážcu čakacej slučky (pozri twi_watch) */
+typedef struct {
+    uint8_t  steps;                     /* naposledy videný twi_steps */
+    uint16_t idle;                      /* počet µs bez pokroku */
+} twi_watch_t;
+
+
+// -- Variables ------------------------------------------------------
+volatile uint8_t twi_busy = 0;          /* 1 = bajtový prístup alebo beží transakcia z fronty */
+
+static twi_xfer_t *twi_queue[TWI_QUEUE_SIZE]; /* čakajúce transakcie v poradí zaradenia */
+static volatile uint8_t twi_qlen = 0;   /* počet čakajúcich transakcií */
+static twi_xfer_t *volatile twi_cur = 0; /* práve bežiaca transakcia */
+static volatile uint8_t twi_claimed = 0; /* 1 = zbernicu drží bajtový prístup */
+static uint8_t twi_pos;                 /* pozícia v aktuálnom buffri */
+static uint8_t twi_wlen;                /* počet zapisovaných bajtov vrátane reg */
+static uint8_t twi_reading;             /* 1 = fáza čítania aktuálnej transakcie */
+static uint8_t twi_sla_next = 0;        /* 1 = ďalší twi_write je SLA (po twi_start) */
+static uint8_t twi_byte_addr = 0;       /* zariadenie bajtového prístupu (počítadlá chýb) */
+static uint8_t twi_fault = 0;           /* 1 = bajtový prístup prekročil čas, do twi_start sa nevysiela */
+static volatile uint8_t twi_stuck = 0;  /* 1 = STOP z fronty neodišiel, zbernicu obnoví strážca (twi_unstick) */
+static volatile uint8_t twi_steps = 0;  /* počítadlo krokov fronty (pokrok pre strážcu) */
+
+static volatile uint16_t twi_bytes = 0; /* bajty na zbernici (čas plánovača), pretáča sa */
+static uint16_t twi_low_bytes = 0;      /* bajty nízkej priority v aktuálnej snímke */
+static uint16_t twi_budget = 0;         /* rozpočet nízkej priority na snímku (0 = bez obmedzenia) */
+static twi_sched_stats_t twi_stats[TWI_PRIO_CLASSES]; /* štatistika plánovača */
+
+static twi_dev_t twi_dev[TWI_DEV_SLOTS]; /* zariadenia s vlastnou rýchlosťou / počítadlami */
+
+#if TWI_TRACE
+static twi_trace_t twi_trace_buf[TWI_TRACE_SIZE]; /* kruhový buffer záznamov */
+static volatile uint8_t twi_trace_head = 0;       /* index zápisu */
+static volatile uint8_t twi_trace_tail = 0;       /* index najstaršieho záznamu */
+static uint16_t twi_trace_dropped = 0;            /* zahodené záznamy (plný buffer) */
+static uint32_t twi_trace_t0;                     /* začiatok aktuálnej transakcie */
+static uint8_t twi_byte_dir;                      /* smer bajtového prístupu (TWI_TRACE_*) */
+static uint8_t twi_byte_count;                    /* počet bajtov bajtového prístupu */
+static uint8_t twi_byte_status;                   /* výsledok bajtového prístupu */
+static uint8_t twi_trace_count0;                  /* x->count na začiatku úseku transakcie */
+#endif
+
+
+// -- Local functions ------------------------------------------------
+
+#if TWI_TRACE
+/**
+ * @brief Zapamätá si začiatok transakcie pre tracer.
+ */
+static void twi_trace_begin(void)
+{
+    twi_trace_t0 = twi_trace_clock();
+}
+
+
+/**
+ * @brief Zapíše záznam dokončenej transakcie do buffra tracera.
+ *
+ * Volať pri zakázaných prerušeniach alebo z nich. Pri plnom buffri
+ * sa záznam zahodí a započíta do twi_trace_dropped.
+ */
+static void twi_trace_end(uint8_t addr, uint8_t dir, uint8_t count, uint8_t status)
+{
+    uint8_t next = (twi_trace_head + 1) & TWI_TRACE_MASK;
+
+    if (next == twi_trace_tail) {
+        twi_trace_dropped++;
+        return;
+    }
+
+    twi_trace_t *r = &twi_trace_buf[twi_trace_head];
+    uint32_t dur   = twi_trace_clock() - twi_trace_t0;
+
+    r->addr  = addr;
+    r->info  = (dir << 6) | (status & 0x07);
+    r->count = count;
+    r->start = twi_trace_t0;
+    r->dur   = (dur > 0xFFFF) ? 0xFFFF : dur;
+    twi_trace_head = next;
+}
+#endif
+
+
+/**
+ * @brief Nájde slot zariadenia @p addr, prípadne obsadí voľný.
+ *
+ * Nový slot má predvolenú rýchlosť @ref F_SCL a nulové počítadlá.
+ *
+ * @param create 1 = pri nenájdení obsadiť voľný slot.
+ * @return Slot alebo NULL (nenájdený / tabuľka plná / adresa ešte nie je známa).
+ */
+static twi_dev_t *twi_dev_find(uint8_t addr, uint8_t create)
+{
+    twi_dev_t *free = 0;
+
+    if (addr == 0) return 0;
+    for (uint8_t i = 0; i < TWI_DEV_SLOTS; i++) {
+        if (twi_dev[i].addr == addr) return &twi_dev[i];
+        if (twi_dev[i].addr == 0 && !free) free = &twi_dev[i];
+    }
+    if (!create || !free) return 0;
+
+    free->addr = addr;
+    free->twbr = TWI_BIT_RATE_REG;
+    free->twps = 0;
+    free->err.nack    = 0;
+    free->err.timeout = 0;
+    free->err.bus     = 0;
+    return free;
+}
+
+
+/**
+ * @brief Nastaví TWBR a pred-deľič pre zariadenie @p addr (pred jeho transakciou).
+ */
+static void twi_apply_speed(uint8_t addr)
+{
+    twi_dev_t *d = twi_dev_find(addr, 0);
+
+    TWBR = d ? d->twbr : TWI_BIT_RATE_REG;
+    TWSR = d ? d->twps : 0;     /* stavové bity TWSR sú len na čítanie */
+}
+
+
+/**
+ * @brief Započíta chybu transakcie zariadeniu @p addr.
+ *
+ * @param status Stav TWI_XF_* (@ref TWI_XF_OK sa nepočíta).
+ */
+static void twi_count_error(uint8_t addr, uint8_t status)
+{
+    twi_dev_t *d;
+
+    if (status == TWI_XF_OK || !(d = twi_dev_find(addr, 1))) return;
+
+    if (status == TWI_XF_NACK_ADDR || status == TWI_XF_NACK_DATA) d->err.nack++;
+    else if (status == TWI_XF_TIMEOUT)                            d->err.timeout++;
+    else                                                          d->err.bus++;
+}
+
+
+/**
+ * @brief Jedna polperióda SCL pri obnove zbernice.
+ *
+ * @param high 1 = SCL uvoľniť (pull-up), 0 = stiahnuť do nuly.
+ */
+static void twi_scl(uint8_t high)
+{
+    if (high) {
+        DDR(TWI_PORT) &= ~(1<<TWI_SCL_PIN);
+        TWI_PORT |= (1<<TWI_SCL_PIN);
+    } else {
+        TWI_PORT &= ~(1<<TWI_SCL_PIN);
+        DDR(TWI_PORT) |= (1<<TWI_SCL_PIN);
+    }
+    _delay_us(TWI_RECOVER_US);
+}
+
+
+/**
+ * @brief Linka SDA pri obnove zbernice (@p high 1 = uvoľniť, 0 = stiahnuť do nuly).
+ */
+static void twi_sda(uint8_t high)
+{
+    if (high) {
+        DDR(TWI_PORT) &= ~(1<<TWI_SDA_PIN);
+        TWI_PORT |= (1<<TWI_SDA_PIN);
+    } else {
+        TWI_PORT &= ~(1<<TWI_SDA_PIN);
+        DDR(TWI_PORT) |= (1<<TWI_SDA_PIN);
+    }
+    _delay_us(TWI_RECOVER_US);
+}
+
+
+/**
+ * @brief Zistí, či nízka priorita vyčerpala rozpočet snímky.
+ */
+static inline uint8_t twi_over_budget(void)
+{
+    return twi_budget && twi_low_bytes >= twi_budget;
+}
+
+
+/**
+ * @brief Vyberie ďalšiu transakciu z fronty podľa priority a termínu.
+ *
+ * Poradie: nízka priorita po termíne (@ref TWI_SCHED_DEADLINE), vysoká
+ * priorita, nízka priorita; v rámci triedy najstaršia. Nízka priorita
+ * po vyčerpaní rozpočtu snímky sa vynechá. Volať pri zakázaných prerušeniach.
+ *
+ * @return Index vo fronte alebo -1, ak nie je čo spustiť.
+ */
+static int8_t twi_pick(void)
+{
+    int8_t high = -1, low = -1;
+
+    for (uint8_t i = 0; i < twi_qlen; i++) {
+        twi_xfer_t *x = twi_queue[i];
+
+        if (!(x->flags & TWI_XF_LOW)) {
+            if (high < 0) high = i;
+        } else if (!twi_over_budget()) {
+            if (TWI_SCHED_DEADLINE && (uint16_t)(twi_bytes - x->stamp) >= TWI_SCHED_DEADLINE)
+                return i;
+            if (low < 0) low = i;
+        }
+    }
+    return (high >= 0) ? high : low;
+}
+
+
+/**
+ * @brief Zistí, či má bežiaci úsek @ref TWI_XF_CHUNK uvoľniť zbernicu.
+ *
+ * Áno, ak čaká transakcia vysokej priority alebo je vyčerpaný rozpočet.
+ */
+static uint8_t twi_yield_due(void)
+{
+    if (twi_over_budget()) return 1;
+    for (uint8_t i = 0; i < twi_qlen; i++)
+        if (!(twi_queue[i]->flags & TWI_XF_LOW)) return 1;
+    return 0;
+}
+
+
+/**
+ * @brief Spustí ďalšiu transakciu z fronty (@ref twi_pick), ak je zbernica voľná.
+ *
+ * Volať pri zakázaných prerušeniach.
+ */
+static void twi_next(void)
+{
+    if (twi_cur || twi_claimed || twi_stuck) return;
+
+    int8_t i = twi_pick();
+    if (i < 0) {
+        twi_busy = 0;
+        return;
+    }
+
+    twi_xfer_t *x = twi_queue[i];
+    twi_qlen--;
+    for (; i < twi_qlen; i++) twi_queue[i] = twi_queue[i + 1];
+
+    if (!(x->status & TWI_XF_SPLIT)) {
+        twi_sched_stats_t *s = &twi_stats[TWI_PRIO(x)];
+        uint16_t wait = twi_bytes - x->stamp;
+
+        s->count++;
+        s->wait_sum += wait;
+        if (wait > s->wait_max) s->wait_max = wait;
+    }
+
+    twi_cur     = x;
+    twi_pos     = 0;
+    twi_wlen    = x->wlen + ((x->flags & TWI_XF_REG) ? 1 : 0);
+    twi_reading = (twi_wlen == 0 && x->rlen);     /* prázdna transakcia = test adresy (SLA+W) */
+    twi_busy    = 1;
+    twi_steps++;
+    TWI_TRACE_BEGIN();
+#if TWI_TRACE
+    twi_trace_count0 = x->count;
+#endif
+    twi_apply_speed(x->addr);
+    TWCR = TWI_CR_NEXT | (1<<TWSTA);
+}
+
+
+/**
+ * @brief Ohlási výsledok aktuálnej transakcie a spustí ďalšiu.
+ *
+ * Volať pri zakázaných prerušeniach.
+ *
+ * @param status Výsledný stav TWI_XF_*.
+ */
+static void twi_complete(uint8_t status)
+{
+    twi_xfer_t *x = twi_cur;
+
+    twi_cur = 0;
+    twi_count_error(x->addr, status);
+    TWI_TRACE_END(x->addr, ((twi_wlen || !x->rlen) ? TWI_TRACE_W : 0) | (x->rlen ? TWI_TRACE_R : 0),
+                  x->count - twi_trace_count0, status);
+    x->status = status;
+    if (x->done)
+        x->done(x);
+    twi_next();
+}
+
+
+/**
+ * @brief Počká na odoslanie STOP najviac @ref TWI_TIMEOUT_US.
+ *
+ * Zbernicu neobnovuje – volá sa aj z ISR, kde 9 hodín SCL nemá čo hľadať.
+ *
+ * @return 0 = STOP odoslaný, 1 = prekročený čas (zbernicu treba obnoviť).
+ */
+static uint8_t twi_wait_stop(void)
+{
+    for (uint16_t t = 0; t < TWI_TIMEOUT_US; t++) {
+        if (!(TWCR & (1<<TWSTO))) return 0;
+        _delay_us(1);
+    }
+    return 1;
+}
+
+
+/**
+ * @brief Ukončí aktuálnu transakciu (STOP), ohlási výsledok a spustí ďalšiu.
+ *
+ * Ak STOP neodíde, transakcia skončí @ref TWI_XF_TIMEOUT a fronta stojí,
+ * kým zbernicu neobnoví strážca mimo ISR (@ref twi_unstick).
+ *
+ * @param status Výsledný stav TWI_XF_*.
+ */
+static void twi_finish(uint8_t status)
+{
+    TWCR = (1<<TWINT) | (1<<TWSTO) | (1<<TWEN);
+    if (twi_wait_stop()) {
+        twi_stuck = 1;
+        status    = TWI_XF_TIMEOUT;
+    }
+    twi_complete(status);
+}
+
+
+/**
+ * @brief Preruší zápis @ref TWI_XF_CHUNK (STOP) a vráti jeho zvyšok na začiatok fronty.
+ *
+ * Odoslané dáta sa z popisovača odoberú (@c wbuf, @c wlen), pokračovanie
+ * pošle znova adresu a bajt @c reg. Miesto vo fronte je isté – bežiaca
+ * transakcia sa do @ref TWI_QUEUE_SIZE počíta.
+ */
+static void twi_yield(void)
+{
+    twi_xfer_t *x = twi_cur;
+    uint8_t sent  = twi_pos - ((x->flags & TWI_XF_REG) ? 1 : 0);
+
+    TWCR = (1<<TWINT) | (1<<TWSTO) | (1<<TWEN);
+    if (twi_wait_stop()) {                      /* zvyšok pôjde až po obnove zbernice */
+        twi_stuck = 1;
+        twi_count_error(x->addr, TWI_XF_TIMEOUT);
+    }
+
+    TWI_TRACE_END(x->addr, TWI_TRACE_W, x->count - twi_trace_count0, TWI_XF_OK);
+    if (!(x->flags & TWI_XF_FILL)) x->wbuf += sent;
+    x->wlen  -= sent;
+    x->stamp  = twi_bytes;
+    x->status = TWI_XF_PENDING | TWI_XF_SPLIT;
+    twi_stats[TWI_PRIO(x)].yields++;
+
+    for (uint8_t i = twi_qlen; i; i--) twi_queue[i] = twi_queue[i - 1];
+    twi_queue[0] = x;
+    twi_qlen++;
+
+    twi_cur = 0;
+    twi_next();
+}
+
+
+/**
+ * @brief Zruší zaseknutú transakciu, obnoví zbernicu a spustí ďalšiu.
+ *
+ * Transakcia sa zruší len vtedy, ak od @p steps neurobila žiadny krok
+ * (medzičasom mohla skončiť a začať iná).
+ */
+static void twi_abort(uint8_t steps)
+{
+    uint8_t sreg = SREG;
+    cli();
+    if (twi_cur && twi_steps == steps) {
+        twi_recover();
+        twi_complete(TWI_XF_TIMEOUT);
+    }
+    SREG = sreg;
+}
+
+
+/**
+ * @brief Obnoví zbernicu po STOP, ktorý v @ref twi_finish / @ref twi_yield neodišiel, a spustí frontu.
+ *
+ * Len mimo ISR – obnova (@ref twi_recover) trvá až 9 hodín SCL.
+ */
+static void twi_unstick(void)
+{
+    uint8_t sreg = SREG;
+    cli();
+    if (twi_stuck) {
+        twi_stuck = 0;
+        twi_recover();
+        twi_next();
+    }
+    SREG = sreg;
+}
+
+
+/**
+ * @brief Vráti zapisovaný bajt na pozícii @p pos (reg, RAM, flash alebo opakovaný bajt).
+ */
+static uint8_t twi_wbyte(const twi_xfer_t *x, uint8_t pos)
+{
+    if (x->flags & TWI_XF_REG) {
+        if (pos == 0) return x->reg;
+        pos--;
+    }
+    if (x->flags & TWI_XF_FILL) pos = 0;
+    if (x->flags & TWI_XF_PGM)  return pgm_read_byte(x->wbuf + pos);
+    return x->wbuf[pos];
+}
+
+
+/**
+ * @brief Jeden krok stavového automatu transakcie (po nastavení TWINT).
+ *
+ * Stavové kódy TWSR podľa dokumentácie ATmega328P (Master Transmitter/Receiver).
+ */
+static void twi_step(void)
+{
+    twi_xfer_t *x = twi_cur;
+    uint8_t status = TWSR & 0xf8;
+
+    twi_steps++;
+    if (status >= 0x18) {                       /* dokončený bajt (SLA alebo dáta) */
+        twi_bytes++;
+        if (x->flags & TWI_XF_LOW) twi_low_bytes++;
+    }
+
+    switch (status) {
+    case 0x08:  /* START odoslaný */
+    case 0x10:  /* opakovaný START odoslaný */
+        TWDR = (x->addr << 1) | (twi_reading ? TWI_READ : TWI_WRITE);
+        TWCR = TWI_CR_NEXT;
+        break;
+
+    case 0x28:  /* dátový bajt odoslaný, ACK */
+        x->count++;
+        /* fall through */
+    case 0x18:  /* SLA+W odoslané, ACK */
+        if (twi_pos < twi_wlen) {
+            if ((x->flags & TWI_XF_CHUNK)
+                && twi_pos >= TWI_SCHED_CHUNK + ((x->flags & TWI_XF_REG) ? 1 : 0)
+                && twi_yield_due()) {
+                twi_yield();
+                break;
+            }
+            TWDR = twi_wbyte(x, twi_pos++);
+            TWCR = TWI_CR_NEXT;
+        } else if (x->rlen) {
+            twi_reading = 1;
+            twi_pos     = 0;
+            if (x->flags & TWI_XF_RESTART)
+                TWCR = TWI_CR_NEXT | (1<<TWSTA);
+            else
+                TWCR = TWI_CR_NEXT | (1<<TWSTO) | (1<<TWSTA);
+        } else {
+            twi_finish(TWI_XF_OK);
+        }
+        break;
+
+    case 0x20:  /* SLA+W odoslané, NACK */
+    case 0x48:  /* SLA+R odoslané, NACK */
+        twi_finish(TWI_XF_NACK_ADDR);
+        break;
+
+    case 0x30:  /* dátový bajt odoslaný, NACK */
+        twi_finish(TWI_XF_NACK_DATA);
+        break;
+
+    case 0x40:  /* SLA+R odoslané, ACK – posledný bajt sa potvrdí NACK */
+        TWCR = TWI_CR_NEXT | ((x->rlen > 1) ? (1<<TWEA) : 0);
+        break;
+
+    case 0x50:  /* bajt prijatý, odoslaný ACK */
+    case 0x58:  /* bajt prijatý, odoslaný NACK */
+        x->rbuf[twi_pos++] = TWDR;
+        x->count++;
+        if (twi_pos >= x->rlen)
+            twi_finish(TWI_XF_OK);
+        else
+            TWCR = TWI_CR_NEXT | ((twi_pos + 1 < x->rlen) ? (1<<TWEA) : 0);
+        break;
+
+    case 0x38:  /* strata arbitráže – zbernicu drží iný master */
+        twi_finish(TWI_XF_ARB_LOST);
+        break;
+
+    default:    /* 0x00 chyba zbernice */
+        twi_finish(TWI_XF_ERROR);
+        break;
+    }
+}
+
+
+/**
+ * @brief Pri zakázaných prerušeniach posunie bežiacu transakciu namiesto ISR.
+ */
+static void twi_poll(void)
+{
+    if (!(SREG & (1<<SREG_I)) && twi_cur && (TWCR & (1<<TWINT)))
+        twi_step();
+}
+
+
+/**
+ * @brief Strážca čakacej slučky – volať v každom jej prechode.
+ *
+ * Ak bežiaca transakcia neurobila krok približne @ref TWI_TIMEOUT_US,
+ * zruší sa (@ref TWI_XF_TIMEOUT) a zbernica sa obnoví. Každá transakcia
+ * z fronty tak skončí v ohraničenom čase. Zbernicu po neodoslanom STOP
+ * obnoví hneď (@ref twi_unstick).
+ */
+static void twi_watch(twi_watch_t *w)
+{
+    twi_poll();
+    if (twi_stuck) twi_unstick();
+
+    uint8_t steps = twi_steps;
+    if (steps != w->steps || !twi_cur) {
+        w->steps = steps;
+        w->idle  = 0;
+        return;
+    }
+    _delay_us(1);
+    if (++w->idle >= TWI_TIMEOUT_US) {
+        w->idle = 0;
+        twi_abort(steps);
+    }
+}
+
+
+/**
+ * @brief Počká na TWINT bajtovej operácie najviac @ref TWI_TIMEOUT_US.
+ *
+ * Pri prekročení obnoví zbernicu a až do ďalšieho @ref twi_start
+ * bajtové funkcie nič nevysielajú.
+ *
+ * @return 0 = TWINT nastavený, 1 = prekročený čas.
+ */
+static uint8_t twi_wait_int(void)
+{
+    for (uint16_t t = 0; t < TWI_TIMEOUT_US; t++) {
+        if (TWCR & (1<<TWINT)) return 0;
+        _delay_us(1);
+    }
+    twi_fault = 1;
+    twi_count_error(twi_byte_addr, TWI_XF_TIMEOUT);
+    twi_recover();
+    return 1;
+}
+
+
+/**
+ * @brief Obsluha prerušenia TWI – posúva transakcie z fronty.
+ */
+ISR(TWI_vect)
+{
+    twi_step();
+}
 
 
 // -- Functions ------------------------------------------------------
@@ -52,6 +675,123 @@ void twi_init(void)
 }
 
 
+/**
+ * @brief Nastaví rýchlosť zbernice pre jedno zariadenie.
+ *
+ * Hľadá sa najmenší pred-deľič (1, 4, 16, 64), pri ktorom sa TWBR zmestí do 8 bitov.
+ *
+ * @param addr 7-bitová slave adresa zariadenia.
+ * @param hz   Rýchlosť SCL v Hz; 0 vráti zariadenie na @ref F_SCL.
+ *
+ * @return 0 = nastavené, 1 = tabuľka je plná.
+ */
+uint8_t twi_set_speed(uint8_t addr, uint32_t hz)
+{
+    twi_dev_t *d = twi_dev_find(addr, 1);
+
+    if (!d) return 1;
+
+    if (hz == 0) {
+        d->twbr = TWI_BIT_RATE_REG;     /* slot ostáva kvôli počítadlám chýb */
+        d->twps = 0;
+        return 0;
+    }
+
+    /* f_SCL = F_CPU / (16 + 2 * TWBR * 4^TWPS) */
+    uint32_t div  = F_CPU / hz;
+    uint32_t twbr = (div > 16) ? (div - 16) / 2 : 0;
+    uint8_t  twps = 0;
+    while (twbr > 255 && twps < 3) {
+        twps++;
+        twbr = (div - 16) / (2UL << (2 * twps));
+    }
+    if (twbr > 255) twbr = 255;
+
+    d->twbr = twbr;
+    d->twps = twps;
+    return 0;
+}
+
+
+/**
+ * @brief Vráti počítadlá chýb zariadenia.
+ *
+ * @param addr 7-bitová slave adresa zariadenia.
+ * @param e    Výstup – kópia počítadiel (nuly, ak zariadenie ešte nemalo chybu).
+ */
+void twi_get_errors(uint8_t addr, twi_errors_t *e)
+{
+    uint8_t sreg = SREG;
+    cli();
+    twi_dev_t *d = twi_dev_find(addr, 0);
+    if (d) {
+        *e = d->err;
+    } else {
+        e->nack    = 0;
+        e->timeout = 0;
+        e->bus     = 0;
+    }
+    SREG = sreg;
+}
+
+
+/**
+ * @brief Vynuluje počítadlá chýb zariadenia.
+ */
+void twi_clear_errors(uint8_t addr)
+{
+    uint8_t sreg = SREG;
+    cli();
+    twi_dev_t *d = twi_dev_find(addr, 0);
+    if (d) {
+        d->err.nack    = 0;
+        d->err.timeout = 0;
+        d->err.bus     = 0;
+    }
+    SREG = sreg;
+}
+
+
+/**
+ * @brief Obnoví zaseknutú zbernicu (9 hodín SCL a STOP).
+ *
+ * Slave, ktorý pri prerušenom čítaní drží SDA v nule, dostane až 9 hodinových
+ * impulzov – dokončí bajt, pri NACK uvoľní SDA a nasledujúci STOP ho vráti
+ * do kľudového stavu. Potom sa TWI jednotka znovu zapne (vynuluje sa aj jej
+ * vnútorný stav).
+ *
+ * @return 0 = obe linky sú voľné, 1 = SDA alebo SCL ostáva v nule.
+ */
+uint8_t twi_recover(void)
+{
+    uint8_t sreg = SREG;
+    cli();
+
+    /* Vypnutie TWI – piny ovláda PORT/DDR, obe linky uvoľnené (pull-up) */
+    TWCR = 0;
+    twi_sda(1);
+    twi_scl(1);
+
+    for (uint8_t i = 0; i < 9 && !(PIN(TWI_PORT) & (1<<TWI_SDA_PIN)); i++) {
+        twi_scl(0);
+        twi_scl(1);
+    }
+
+    /* STOP: SDA 0 → 1 pri SCL = 1 */
+    twi_scl(0);
+    twi_sda(0);
+    twi_scl(1);
+    twi_sda(1);
+
+    uint8_t stuck = (PIN(TWI_PORT) & ((1<<TWI_SDA_PIN) | (1<<TWI_SCL_PIN)))
+                    != ((1<<TWI_SDA_PIN) | (1<<TWI_SCL_PIN));
+
+    TWCR = (1<<TWEN);
+    SREG = sreg;
+    return stuck;
+}
+
+
 /**
  * @brief Vygeneruje podmienku Start na I2C/TWI zbernici.
  *
@@ -62,6 +802,29 @@ void twi_init(void)
  */
 void twi_start(void)
 {
+    twi_watch_t w = { twi_steps, 0 };
+
+    /* Počkať na dokončenie fronty; opakovaný START vlastníka už nečaká */
+    while (!twi_claimed) {
+        uint8_t sreg = SREG;
+        cli();
+        if (!twi_cur && !twi_stuck && twi_pick() < 0) {
+            twi_claimed = 1;
+            twi_busy    = 1;
+#if TWI_TRACE
+            twi_trace_begin();
+            twi_byte_dir    = 0;
+            twi_byte_count  = 0;
+            twi_byte_status = TWI_XF_OK;
+#endif
+        }
+        SREG = sreg;
+        twi_watch(&w);
+    }
+    twi_sla_next  = 1;
+    twi_fault     = 0;
+    twi_byte_addr = 0;
+
     /* Odoslanie START podmienky:
        - TWINT = 1 (vynulovanie príznaku zápisom 1),
        - TWSTA = 1 (generovanie START),
@@ -69,7 +832,7 @@ void twi_start(void)
     TWCR = (1<<TWINT) | (1<<TWSTA) | (1<<TWEN);
 
     /* Čakanie na dokončenie operácie (TWINT sa nastaví na 1) */
-    while ((TWCR & (1<<TWINT)) == 0);
+    twi_wait_int();
 }
 
 
@@ -89,6 +852,15 @@ uint8_t twi_write(uint8_t data)
 {
     uint8_t twi_status;
 
+    if (twi_fault) return 1;    /* zbernica bola po timeoute obnovená */
+
+    /* SLA – rýchlosť zbernice podľa zariadenia (SCL je po Start podržaný v nule) */
+    if (twi_sla_next) {
+        twi_sla_next  = 0;
+        twi_byte_addr = data >> 1;
+        twi_apply_speed(twi_byte_addr);
+    }
+
     /* Zapísanie SLA+R, SLA+W alebo dátového bajtu do dátového registra TWI */
     TWDR = data;
 
@@ -98,7 +870,8 @@ uint8_t twi_write(uint8_t data)
     TWCR = (1<<TWINT) | (1<<TWEN);
 
     /* Čakanie na dokončenie prenosu (TWINT = 1) */
-    while ((TWCR & (1<<TWINT)) == 0);
+    if (twi_wait_int()) return 1;
+    twi_bytes++;        /* fronta stojí (twi_claimed), ISR počítadlo nemení */
 
     /* Kontrola stavového registra TWSR (iba horných 5 bitov) */
     twi_status = TWSR & 0xf8;
@@ -107,10 +880,21 @@ uint8_t twi_write(uint8_t data)
          - 0x18: SLA+W odoslané a prijaté ACK
          - 0x28: dátový bajt odoslaný a prijaté ACK
          - 0x40: SLA+R odoslané a prijaté ACK */
-    if (twi_status == 0x18 || twi_status == 0x28 || twi_status == 0x40)
+    if (twi_status == 0x18 || twi_status == 0x28 || twi_status == 0x40) {
+#if TWI_TRACE
+        if (twi_status == 0x28) twi_byte_count++;
+        else                    twi_byte_dir |= (twi_status == 0x40) ? TWI_TRACE_R : TWI_TRACE_W;
+#endif
         return 0;   /* ACK prijaté */
-    else
-        return 1;   /* NACK prijaté */
+    }
+
+    twi_status = (twi_status == 0x38) ? TWI_XF_ARB_LOST :
+                 (twi_status == 0x30) ? TWI_XF_NACK_DATA : TWI_XF_NACK_ADDR;
+    twi_count_error(twi_byte_addr, twi_status);
+#if TWI_TRACE
+    twi_byte_status = twi_status;
+#endif
+    return 1;       /* NACK prijaté */
 }
 
 
@@ -127,6 +911,8 @@ uint8_t twi_write(uint8_t data)
  */
 uint8_t twi_read(uint8_t ack)
 {
+    if (twi_fault) return 0xFF;
+
     if (ack == TWI_ACK)
         /* Čítanie s odoslaním ACK po prijatí bajtu (pokračujeme v čítaní) */
         TWCR = (1<<TWINT) | (1<<TWEN) | (1<<TWEA);
@@ -135,7 +921,12 @@ uint8_t twi_read(uint8_t ack)
         TWCR = (1<<TWINT) | (1<<TWEN);
 
     /* Čakanie na dokončenie prijmu (TWINT = 1) */
-    while ((TWCR & (1<<TWINT)) == 0);
+    if (twi_wait_int()) return 0xFF;
+    twi_bytes++;
+
+#if TWI_TRACE
+    twi_byte_count++;
+#endif
 
     /* Vrátenie prijatého bajtu z registra TWDR */
     return (TWDR);
@@ -156,7 +947,21 @@ void twi_stop(void)
        - TWINT = 1 (vynulovanie príznaku),
        - TWSTO = 1 (generovanie STOP),
        - TWEN = 1 (povolenie TWI). */
-    TWCR = (1<<TWINT) | (1<<TWSTO) | (1<<TWEN);
+    if (!twi_fault) {
+        TWCR = (1<<TWINT) | (1<<TWSTO) | (1<<TWEN);
+
+        /* Čakanie na odoslanie Stop (TWSTO sa vynuluje), potom je zbernica voľná */
+        if (twi_wait_stop()) twi_recover();
+    }
+
+    /* Uvoľnenie zbernice a spustenie transakcií, ktoré medzitým pribudli */
+    uint8_t sreg = SREG;
+    cli();
+    TWI_TRACE_END(twi_byte_addr, twi_byte_dir ? twi_byte_dir : TWI_TRACE_W,
+                  twi_byte_count, twi_fault ? TWI_XF_TIMEOUT : twi_byte_status);
+    twi_claimed = 0;
+    twi_next();
+    SREG = sreg;
 }
 
 
@@ -177,13 +982,7 @@ void twi_stop(void)
  */
 uint8_t twi_test_address(uint8_t addr)
 {
-    uint8_t ack;  // ACK odpoveď od Slave
-
-    twi_start();
-    ack = twi_write((addr<<1) | TWI_WRITE);
-    twi_stop();
-
-    return ack;
+    return (twi_write_block(addr, 0, 0) == TWI_XF_OK) ? 0 : 1;
 }
 
 
@@ -201,38 +1000,270 @@ uint8_t twi_test_address(uint8_t addr)
  * @param buf     Ukazovateľ na buffer, do ktorého sa budú ukladať prijaté dáta.
  * @param nbytes  Počet bajtov, ktoré sa majú prečítať.
  *
- * @return Funkcia nevracia žiadnu hodnotu.
+ * @return Stav transakcie.
  */
-void twi_readfrom_mem_into(uint8_t addr, uint8_t memaddr, volatile uint8_t *buf, uint8_t nbytes)
-{
-    /* Začiatok zápisu počiatočnej adresy do zariadenia (write fáza) */
-    twi_start();
-    if (twi_write((addr<<1) | TWI_WRITE) == 0)
-    {
-        // Nastavenie počiatočnej adresy vnútornej pamäte/registra
-        twi_write(memaddr);
-        twi_stop();
-
-        // Čítanie dát z periférie (read fáza)
-        twi_start();
-        twi_write((addr<<1) | TWI_READ);
-
-        if (nbytes >= 2)
-        {
-            // Čítanie všetkých okrem posledného bajtu s ACK (pokračujeme v čítaní)
-            for (uint8_t i=0; i<(nbytes-1); i++)
-            {
-                *buf++ = twi_read(TWI_ACK);
-            }
-        }
+uint8_t twi_readfrom_mem_into(uint8_t addr, uint8_t memaddr, volatile uint8_t *buf, uint8_t nbytes)
+{
+    return twi_write_read(addr, &memaddr, 1, (uint8_t *)buf, nbytes);
+}
+
+
+/**
+ * @brief Vykoná jednu blokujúcu transakciu s danými parametrami.
+ */
+static uint8_t twi_xfer_run(uint8_t addr, uint8_t flags, uint8_t reg,
+                            const uint8_t *wbuf, uint8_t wlen,
+                            uint8_t *rbuf, uint8_t rlen)
+{
+    twi_xfer_t x;
+
+    x.addr   = addr;
+    x.flags  = flags;
+    x.reg    = reg;
+    x.wbuf   = wbuf;
+    x.wlen   = wlen;
+    x.rbuf   = rbuf;
+    x.rlen   = rlen;
+    x.count  = 0;
+    x.status = TWI_XF_OK;
+    x.done   = 0;
+    return twi_transfer(&x);
+}
+
+
+/**
+ * @brief Zapíše blok dát z RAM.
+ */
+uint8_t twi_write_block(uint8_t addr, const uint8_t *buf, uint8_t len)
+{
+    return twi_xfer_run(addr, 0, 0, buf, len, 0, 0);
+}
+
+
+/**
+ * @brief Zapíše bajt @p reg a blok dát z RAM.
+ */
+uint8_t twi_write_reg(uint8_t addr, uint8_t reg, const uint8_t *buf, uint8_t len)
+{
+    return twi_xfer_run(addr, TWI_XF_REG, reg, buf, len, 0, 0);
+}
+
+
+/**
+ * @brief Zapíše bajt @p reg a blok dát z PROGMEM.
+ */
+uint8_t twi_write_reg_P(uint8_t addr, uint8_t reg, const uint8_t *buf, uint8_t len)
+{
+    return twi_xfer_run(addr, TWI_XF_REG | TWI_XF_PGM, reg, buf, len, 0, 0);
+}
+
+
+/**
+ * @brief Prečíta blok dát.
+ */
+uint8_t twi_read_block(uint8_t addr, uint8_t *buf, uint8_t len)
+{
+    return twi_xfer_run(addr, 0, 0, 0, 0, buf, len);
+}
+
+
+/**
+ * @brief Zapíše blok a po opakovanom START prečíta odpoveď.
+ */
+uint8_t twi_write_read(uint8_t addr, const uint8_t *wbuf, uint8_t wlen, uint8_t *rbuf, uint8_t rlen)
+{
+    return twi_xfer_run(addr, TWI_XF_RESTART, 0, wbuf, wlen, rbuf, rlen);
+}
+
 
-        // Posledný bajt čítame s NACK (ukončenie čítania)
-        *buf = twi_read(TWI_NACK);
-        twi_stop();
+/**
+ * @brief Zaradí transakciu do fronty.
+ *
+ * @param x Popisovač transakcie.
+ *
+ * @return 0 = zaradená, 1 = fronta je plná alebo @p x ešte nie je dokončená.
+ */
+uint8_t twi_submit(twi_xfer_t *x)
+{
+    uint8_t ret  = 1;
+    uint8_t sreg = SREG;
+
+    if (twi_stuck) twi_unstick();
+    cli();
+
+    if (twi_done(x) && twi_qlen + (twi_cur ? 1 : 0) < TWI_QUEUE_SIZE) {
+        x->count  = 0;
+        x->status = TWI_XF_PENDING;
+        x->stamp  = twi_bytes;
+        twi_queue[twi_qlen++] = x;
+        twi_next();
+        ret = 0;
     }
-    else
-    {
-        // Ak zariadenie neodpovedalo na SLA+W, ukončíme komunikáciu
-        twi_stop();
+
+    SREG = sreg;
+    return ret;
+}
+
+
+/**
+ * @brief Počká na dokončenie transakcie (ohraničene).
+ *
+ * @param x Popisovač transakcie.
+ *
+ * @return Výsledný stav transakcie.
+ */
+uint8_t twi_wait(twi_xfer_t *x)
+{
+    twi_watch_t w = { twi_steps, 0 };
+
+    while (!twi_done(x))
+        twi_watch(&w);
+    return x->status;
+}
+
+
+/**
+ * @brief Zaradí transakciu; ak je fronta plná alebo @p x nedokončená, počká.
+ *
+ * @param x Popisovač transakcie.
+ */
+void twi_submit_wait(twi_xfer_t *x)
+{
+    twi_watch_t w = { twi_steps, 0 };
+
+    while (twi_submit(x))
+        twi_watch(&w);
+}
+
+
+/**
+ * @brief Zaradí transakciu a počká na jej dokončenie.
+ *
+ * @param x Popisovač transakcie.
+ *
+ * @return Výsledný stav transakcie.
+ */
+uint8_t twi_transfer(twi_xfer_t *x)
+{
+    twi_submit_wait(x);
+    return twi_wait(x);
+}
+
+
+/**
+ * @brief Nastaví rozpočet snímky pre nízku prioritu.
+ *
+ * @param bytes Bajty na snímku, 0 = bez obmedzenia.
+ */
+void twi_sched_budget(uint16_t bytes)
+{
+    uint8_t sreg = SREG;
+    cli();
+    twi_budget = bytes;
+    twi_next();
+    SREG = sreg;
+}
+
+
+/**
+ * @brief Začne novú snímku (obnoví rozpočet) a spustí odložené transakcie.
+ */
+void twi_sched_frame(void)
+{
+    uint8_t sreg = SREG;
+    cli();
+    twi_low_bytes = 0;
+    twi_next();
+    SREG = sreg;
+}
+
+
+/**
+ * @brief Skopíruje štatistiku plánovača pre triedu @p prio.
+ *
+ * @param prio @ref TWI_PRIO_HIGH alebo @ref TWI_PRIO_LOW.
+ * @param st   Výstup.
+ */
+void twi_sched_get_stats(uint8_t prio, twi_sched_stats_t *st)
+{
+    uint8_t sreg = SREG;
+    cli();
+    *st = twi_stats[prio < TWI_PRIO_CLASSES ? prio : TWI_PRIO_LOW];
+    SREG = sreg;
+}
+
+
+/**
+ * @brief Vynuluje štatistiku plánovača.
+ */
+void twi_sched_clear_stats(void)
+{
+    uint8_t sreg = SREG;
+    cli();
+    for (uint8_t i = 0; i < TWI_PRIO_CLASSES; i++) {
+        twi_stats[i].count    = 0;
+        twi_stats[i].wait_max = 0;
+        twi_stats[i].wait_sum = 0;
+        twi_stats[i].yields   = 0;
+    }
+    SREG = sreg;
+}
+
+
+#if TWI_TRACE
+/**
+ * @brief Vypíše záznamy tracera v binárnom formáte (pozri twi.h) a uvoľní ich.
+ *
+ * @param put Funkcia na odoslanie jedného bajtu.
+ */
+void twi_trace_dump(void (*put)(unsigned char))
+{
+    uint8_t  sreg = SREG;
+    uint8_t  sum;
+    uint16_t dropped;
+    uint8_t  n;
+
+    cli();
+    n       = (twi_trace_head - twi_trace_tail) & TWI_TRACE_MASK;
+    dropped = twi_trace_dropped;
+    twi_trace_dropped = 0;
+    SREG = sreg;
+
+    /* Prázdny blok by len zahlcoval UART (a spomaľoval meranú slučku) */
+    if (n == 0 && dropped == 0) return;
+
+    put(0xA5);
+    put(0x5A);
+    put(1);                                     /* verzia formátu */
+    put(TWI_TRACE_TICK_US);
+    put(n);
+    put(dropped & 0xFF);
+    put(dropped >> 8);
+    sum = 1 + TWI_TRACE_TICK_US + n + (dropped & 0xFF) + (dropped >> 8);
+
+    while (n--) {
+        twi_trace_t r;
+        uint8_t b[9];
+
+        cli();
+        r = twi_trace_buf[twi_trace_tail];
+        twi_trace_tail = (twi_trace_tail + 1) & TWI_TRACE_MASK;
+        SREG = sreg;
+
+        b[0] = r.addr;
+        b[1] = r.info;
+        b[2] = r.count;
+        b[3] = r.start;
+        b[4] = r.start >> 8;
+        b[5] = r.start >> 16;
+        b[6] = r.start >> 24;
+        b[7] = r.dur;
+        b[8] = r.dur >> 8;
+        for (uint8_t i = 0; i < sizeof(b); i++) {
+            put(b[i]);
+            sum += b[i];
+        }
     }
+    put(sum);
 }
+#endif
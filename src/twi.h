@@ -46,13 +46,74 @@ extern "C" {
 # define F_CPU 16000000 /**< @brief Frekvencia CPU v Hz, potrebná pre výpočet TWI_BIT_RATE_REG. */
 #endif
 
-#define F_SCL 100000 /**< @brief I2C/TWI bitová rýchlosť v Hz. Musí byť väčšia ako približne 31 kHz. */
+#define F_SCL 100000 /**< @brief Predvolená I2C/TWI bitová rýchlosť v Hz (zariadenia bez @ref twi_set_speed). */
 
 /**
  * @brief Hodnota registra rýchlosti TWI (TWBR) podľa vzťahu
  *        \f$ f_{SCL} = \frac{f_{CPU}}{16 + 2 \cdot TWBR} \f$.
  */
 #define TWI_BIT_RATE_REG ((F_CPU/F_SCL - 16) / 2) /**< @brief Hodnota pre TWI bit rate register. */
+
+/**
+ * @brief Počet zariadení s vlastnou rýchlosťou (@ref twi_set_speed) a počítadlami chýb (@ref twi_get_errors).
+ */
+#ifndef TWI_DEV_SLOTS
+# define TWI_DEV_SLOTS 4
+#endif
+
+/**
+ * @brief Najdlhšie čakanie na jeden krok TWI v µs (približne).
+ *
+ * Jeden bajt trvá pri 100 kHz ~90 µs; ak TWINT, STOP alebo krok transakcie
+ * z fronty neprídu do tohto času (slave drží SCL/SDA v nule), zbernica sa
+ * obnoví (@ref twi_recover).
+ */
+#ifndef TWI_TIMEOUT_US
+# define TWI_TIMEOUT_US 2000
+#endif
+/** @} */
+
+
+/**
+ * @name Tracer transakcií
+ *
+ * Pri @ref TWI_TRACE = 1 sa každá transakcia (z fronty aj bajtový prístup
+ * od twi_start po twi_stop) zapíše do kruhového buffra v RAM: adresa, smer,
+ * počet bajtov, začiatok, trvanie a výsledok. @ref twi_trace_dump buffer
+ * vypíše v binárnom formáte (napr. cez uart_putc), nástroj
+ * `tools/twi_trace.py` z neho spraví prehľad vyťaženia zbernice.
+ *
+ * Formát výpisu (viacbajtové hodnoty little-endian):
+ *  - hlavička: 0xA5 0x5A, verzia (1), dĺžka tiku v µs, počet záznamov n,
+ *    počet zahodených záznamov (2 B),
+ *  - n záznamov po 9 B: adresa, info (bity 7–6 smer @ref TWI_TRACE_W /
+ *    @ref TWI_TRACE_R, bity 2–0 stav TWI_XF_*), počet bajtov, začiatok (4 B),
+ *    trvanie (2 B) – oboje v tikoch @ref twi_trace_clock,
+ *  - súčet všetkých bajtov za 0xA5 0x5A (mod 256).
+ *
+ * Pri @ref TWI_TRACE = 0 sa z tracera neprekladá nič.
+ * @{
+ */
+
+/** @brief 1 = zapnúť tracer transakcií (aplikácia musí dodať @ref twi_trace_clock). */
+#ifndef TWI_TRACE
+# define TWI_TRACE 0
+#endif
+
+/** @brief Počet záznamov v kruhovom buffri tracera (mocnina 2, 9 B na záznam). */
+#ifndef TWI_TRACE_SIZE
+# define TWI_TRACE_SIZE 16
+#endif
+
+/** @brief Dĺžka tiku @ref twi_trace_clock v µs (Timer0 s pred-deličom 64 pri 16 MHz). */
+#ifndef TWI_TRACE_TICK_US
+# define TWI_TRACE_TICK_US 4
+#endif
+
+/** @brief Smer v zázname tracera: zápis. */
+#define TWI_TRACE_W 1
+/** @brief Smer v zázname tracera: čítanie (spolu so zápisom = zápis a čítanie). */
+#define TWI_TRACE_R 2
 /** @} */
 
 
@@ -109,6 +170,138 @@ extern "C" {
 /** @} */
 
 
+/**
+ * @name Asynchrónne transakcie
+ * @{
+ */
+
+/**
+ * @brief Počet transakcií, ktoré môžu byť naraz vo fronte vrátane bežiacej.
+ *
+ * Bežia len tie, ktoré ešte nie sú dokončené – jeden popisovač zaberá
+ * vo fronte jedno miesto, kým nie je prenesený.
+ */
+#ifndef TWI_QUEUE_SIZE
+# define TWI_QUEUE_SIZE 4
+#endif
+
+/** @brief Príznak transakcie: medzi zápisom a čítaním opakovaný START (inak STOP a nový START). */
+#define TWI_XF_RESTART 0x01
+/** @brief Príznak transakcie: pred @c wbuf sa pošle bajt @c reg (adresa registra, riadiaci bajt). */
+#define TWI_XF_REG 0x02
+/** @brief Príznak transakcie: @c wbuf leží vo flash pamäti (PROGMEM). */
+#define TWI_XF_PGM 0x04
+/** @brief Príznak transakcie: @c wbuf[0] sa pošle @c wlen-krát (napr. mazanie displeja). */
+#define TWI_XF_FILL 0x08
+/** @brief Príznak transakcie: nízka priorita (@ref TWI_PRIO_LOW, napr. displej); bez neho @ref TWI_PRIO_HIGH. */
+#define TWI_XF_LOW 0x10
+/**
+ * @brief Príznak transakcie: zápis sa smie deliť po @ref TWI_SCHED_CHUNK bajtoch.
+ *
+ * Len pre zariadenia, ktoré po novom STARTe a rovnakom bajte @c reg
+ * pokračujú v zápise (dátový prúd SSD1306). Pri delení sa menia
+ * @c wbuf a @c wlen popisovača.
+ */
+#define TWI_XF_CHUNK 0x20
+
+/** @brief Stav transakcie: úspešne dokončená. */
+#define TWI_XF_OK 0
+/** @brief Stav transakcie: zariadenie nepotvrdilo adresu (SLA+W/SLA+R). */
+#define TWI_XF_NACK_ADDR 1
+/** @brief Stav transakcie: zariadenie nepotvrdilo dátový bajt. */
+#define TWI_XF_NACK_DATA 2
+/** @brief Stav transakcie: chyba zbernice (neplatný START/STOP). */
+#define TWI_XF_ERROR 3
+/** @brief Stav transakcie: strata arbitráže (iný master na zbernici). */
+#define TWI_XF_ARB_LOST 4
+/** @brief Stav transakcie: prekročený čas (@ref TWI_TIMEOUT_US), zbernica sa obnoví mimo ISR. */
+#define TWI_XF_TIMEOUT 5
+/** @brief Stav transakcie: čaká vo fronte alebo práve beží. */
+#define TWI_XF_PENDING 0x80
+/** @} */
+
+
+/**
+ * @name Plánovač zbernice
+ *
+ * Z fronty sa spúšťa prvá čakajúca transakcia @ref TWI_PRIO_HIGH (tuner),
+ * až potom @ref TWI_PRIO_LOW (displej), v rámci triedy v poradí zaradenia.
+ * Transakcia nízkej priority, ktorá čaká dlhšie ako @ref TWI_SCHED_DEADLINE,
+ * ide pred vysokú prioritu. Zápis s @ref TWI_XF_CHUNK sa po každých
+ * @ref TWI_SCHED_CHUNK bajtoch preruší (STOP), ak čaká transakcia vysokej
+ * priority alebo je vyčerpaný rozpočet snímky (@ref twi_sched_budget),
+ * a pokračuje neskôr. Tuner tak čaká najviac jeden úsek displeja.
+ *
+ * Čas sa meria v bajtoch na zbernici (adresa aj dáta, 1 bajt ≈ 9 taktov SCL,
+ * pri 400 kHz 22,5 µs), takže plánovač nepotrebuje časovač.
+ * @{
+ */
+
+/** @brief Trieda priority: transakcie bez @ref TWI_XF_LOW. */
+#define TWI_PRIO_HIGH 0
+/** @brief Trieda priority: transakcie s @ref TWI_XF_LOW. */
+#define TWI_PRIO_LOW 1
+/** @brief Počet tried priority. */
+#define TWI_PRIO_CLASSES 2
+
+/** @brief Dĺžka úseku zápisu s @ref TWI_XF_CHUNK v dátových bajtoch. */
+#ifndef TWI_SCHED_CHUNK
+# define TWI_SCHED_CHUNK 32
+#endif
+
+/** @brief Po koľkých bajtoch na zbernici predbehne čakajúca nízka priorita vysokú (0 = nikdy). */
+#ifndef TWI_SCHED_DEADLINE
+# define TWI_SCHED_DEADLINE 1024
+#endif
+/** @} */
+
+
+// -- Types ----------------------------------------------------------
+
+/**
+ * @brief Popisovač jednej I2C transakcie pre @ref twi_submit.
+ *
+ * Transakcia = START, SLA+W, voliteľne bajt @c reg (@ref TWI_XF_REG)
+ * a @c wlen bajtov z @c wbuf (RAM, flash alebo opakovaný bajt), potom
+ * (ak je @c rlen > 0) opakovaný START alebo STOP+START, SLA+R a @c rlen
+ * bajtov do @c rbuf, nakoniec STOP. Ak sa nič nezapisuje, ide o čisté čítanie.
+ *
+ * Popisovač aj buffre musia platiť, kým transakcia nie je dokončená
+ * (@ref twi_done). Nulami inicializovaný popisovač je „dokončený“.
+ */
+typedef struct twi_xfer twi_xfer_t;
+
+/** @brief Štruktúra popisovača transakcie (@ref twi_xfer_t). */
+struct twi_xfer {
+    uint8_t addr;                   /**< @brief 7-bitová slave adresa. */
+    uint8_t flags;                  /**< @brief Príznaky TWI_XF_* (napr. @ref TWI_XF_RESTART). */
+    uint8_t reg;                    /**< @brief Bajt pred dátami pri @ref TWI_XF_REG. */
+    const uint8_t *wbuf;            /**< @brief Zapisované dáta. */
+    uint8_t wlen;                   /**< @brief Počet zapisovaných bajtov. */
+    uint8_t *rbuf;                  /**< @brief Buffer pre čítané dáta. */
+    uint8_t rlen;                   /**< @brief Počet čítaných bajtov. */
+    uint8_t count;                  /**< @brief Výstup: počet prenesených (potvrdených/prijatých) bajtov vrátane @c reg. */
+    volatile uint8_t status;        /**< @brief Výstup: TWI_XF_* stav. */
+    void (*done)(twi_xfer_t *x);    /**< @brief Volá sa po dokončení (v prerušení), môže byť NULL. */
+    uint16_t stamp;                 /**< @brief Interné: počítadlo bajtov zbernice pri zaradení (vyplní @ref twi_submit). */
+};
+
+/** @brief Štatistika plánovača pre jednu triedu priority (@ref twi_sched_get_stats). */
+typedef struct {
+    uint16_t count;                 /**< @brief Počet spustených transakcií. */
+    uint16_t wait_max;              /**< @brief Najdlhšie čakanie vo fronte v bajtoch zbernice. */
+    uint32_t wait_sum;              /**< @brief Súčet čakaní v bajtoch zbernice (priemer = wait_sum / count). */
+    uint16_t yields;                /**< @brief Počet prerušených úsekov (@ref TWI_XF_CHUNK). */
+} twi_sched_stats_t;
+
+/** @brief Počítadlá chýb jedného zariadenia (@ref twi_get_errors). */
+typedef struct {
+    uint16_t nack;                  /**< @brief NACK po adrese alebo dátovom bajte. */
+    uint16_t timeout;               /**< @brief Prekročený čas – zaseknutá zbernica. */
+    uint16_t bus;                   /**< @brief Chyba zbernice alebo strata arbitráže. */
+} twi_errors_t;
+
+
 // -- Function prototypes --------------------------------------------
 
 /**
@@ -124,12 +317,68 @@ extern "C" {
 void twi_init(void);
 
 
+/**
+ * @brief Nastaví rýchlosť zbernice (SCL) pre jedno zariadenie.
+ *
+ * TWBR a pred-deľič sa prepínajú pred každou transakciou podľa adresy
+ * zariadenia – rýchle zariadenia (400 kHz Fast-mode) tak môžu zdieľať
+ * zbernicu s pomalými. Zariadenia bez nastavenia používajú @ref F_SCL.
+ *
+ * Rýchlosť sa zaokrúhli nadol na najbližšiu dosiahnuteľnú hodnotu
+ * \f$ f_{SCL} = \frac{f_{CPU}}{16 + 2 \cdot TWBR \cdot 4^{TWPS}} \f$.
+ *
+ * @param addr 7-bitová slave adresa zariadenia.
+ * @param hz   Rýchlosť SCL v Hz; 0 vráti zariadenie na @ref F_SCL.
+ *
+ * @return 0 = nastavené, 1 = tabuľka @ref TWI_DEV_SLOTS je plná.
+ */
+uint8_t twi_set_speed(uint8_t addr, uint32_t hz);
+
+
+/**
+ * @brief Vráti počítadlá chýb jedného zariadenia.
+ *
+ * Chyby sa počítajú pre transakcie z fronty aj bajtový prístup. Zariadenie
+ * dostane slot pri @ref twi_set_speed alebo pri prvej chybe (ak je voľný).
+ *
+ * @param addr 7-bitová slave adresa zariadenia.
+ * @param e    Výstup – kópia počítadiel.
+ */
+void twi_get_errors(uint8_t addr, twi_errors_t *e);
+
+
+/**
+ * @brief Vynuluje počítadlá chýb jedného zariadenia.
+ *
+ * @param addr 7-bitová slave adresa zariadenia.
+ */
+void twi_clear_errors(uint8_t addr);
+
+
+/**
+ * @brief Obnoví zaseknutú zbernicu: až 9 hodinových impulzov SCL a STOP.
+ *
+ * Volá sa automaticky po prekročení @ref TWI_TIMEOUT_US; dá sa zavolať
+ * aj pri štarte, ak mohol reset MCU prerušiť transakciu.
+ *
+ * @return 0 = zbernica je voľná, 1 = SDA alebo SCL ostáva v nule.
+ */
+uint8_t twi_recover(void);
+
+
 /**
  * @brief Vygeneruje podmienku Start na I2C/TWI zbernici.
  *
  * Funkcia odošle Start podmienku na zbernicu a čaká, kým je prenos
  * dokončený (TWI nastaví príslušný stav v TWSR).
  *
+ * Prvý twi_start počká, kým sa nedokončia transakcie z fronty
+ * (@ref twi_submit); zbernica potom patrí volajúcemu až po @ref twi_stop.
+ *
+ * Ak niektorá bajtová operácia prekročí @ref TWI_TIMEOUT_US, zbernica sa
+ * obnoví a ďalšie twi_write/twi_read až do nového twi_start hneď vrátia
+ * NACK / 0xFF.
+ *
  * @return Funkcia nevracia žiadnu hodnotu.
  */
 void twi_start(void);
@@ -148,6 +397,9 @@ void twi_start(void);
  * @retval 0 ACK bol prijatý
  * @retval 1 NACK bol prijatý
  *
+ * Ak bajt nasleduje hneď po @ref twi_start (SLA+R/W), najprv sa nastaví
+ * rýchlosť zbernice pre dané zariadenie (@ref twi_set_speed).
+ *
  * @note Funkcia vracia 0, ak je detegovaný stavový kód TWI 0x18, 0x28 alebo 0x40:
  *       - 0x18: SLA+W bol odoslaný a ACK prijatý\n
  *       - 0x28: Dátový bajt bol odoslaný a ACK prijatý\n
@@ -175,12 +427,78 @@ uint8_t twi_read(uint8_t ack);
  *
  * Funkcia odošle Stop podmienku, čím uvoľní zbernicu. Po vykonaní Stop
  * môže iný Master zariadenie prevziať kontrolu nad I2C/TWI zbernicou.
+ * Nakoniec uvoľní zbernicu a spustí transakcie čakajúce vo fronte.
  *
  * @return Funkcia nevracia žiadnu hodnotu.
  */
 void twi_stop(void);
 
 
+/**
+ * @brief Zapíše blok dát z RAM (START, SLA+W, @p len bajtov, STOP).
+ *
+ * @param addr Slave adresa zariadenia.
+ * @param buf  Dáta.
+ * @param len  Počet bajtov.
+ *
+ * @return Stav transakcie (@ref TWI_XF_OK, @ref TWI_XF_NACK_ADDR, @ref TWI_XF_NACK_DATA,
+ *         @ref TWI_XF_ERROR, @ref TWI_XF_ARB_LOST).
+ */
+uint8_t twi_write_block(uint8_t addr, const uint8_t *buf, uint8_t len);
+
+
+/**
+ * @brief Zapíše bajt @p reg a za ním blok dát z RAM v jednej transakcii.
+ *
+ * @param addr Slave adresa zariadenia.
+ * @param reg  Adresa registra alebo riadiaci bajt.
+ * @param buf  Dáta.
+ * @param len  Počet bajtov (najviac 254).
+ *
+ * @return Stav transakcie.
+ */
+uint8_t twi_write_reg(uint8_t addr, uint8_t reg, const uint8_t *buf, uint8_t len);
+
+
+/**
+ * @brief Zapíše bajt @p reg a za ním blok dát z flash pamäte (PROGMEM) v jednej transakcii.
+ *
+ * @param addr Slave adresa zariadenia.
+ * @param reg  Adresa registra alebo riadiaci bajt.
+ * @param buf  Dáta v PROGMEM.
+ * @param len  Počet bajtov (najviac 254).
+ *
+ * @return Stav transakcie.
+ */
+uint8_t twi_write_reg_P(uint8_t addr, uint8_t reg, const uint8_t *buf, uint8_t len);
+
+
+/**
+ * @brief Prečíta blok dát (START, SLA+R, @p len bajtov, STOP).
+ *
+ * @param addr Slave adresa zariadenia.
+ * @param buf  Buffer pre prijaté dáta.
+ * @param len  Počet bajtov.
+ *
+ * @return Stav transakcie.
+ */
+uint8_t twi_read_block(uint8_t addr, uint8_t *buf, uint8_t len);
+
+
+/**
+ * @brief Zapíše blok a po opakovanom START prečíta odpoveď (jedna transakcia).
+ *
+ * @param addr Slave adresa zariadenia.
+ * @param wbuf Zapisované dáta (napr. adresa registra).
+ * @param wlen Počet zapisovaných bajtov.
+ * @param rbuf Buffer pre prijaté dáta.
+ * @param rlen Počet čítaných bajtov.
+ *
+ * @return Stav transakcie.
+ */
+uint8_t twi_write_read(uint8_t addr, const uint8_t *wbuf, uint8_t wlen, uint8_t *rbuf, uint8_t rlen);
+
+
 /**
  * @brief Otestuje prítomnosť I2C zariadenia na zbernici.
  *
@@ -202,7 +520,7 @@ uint8_t twi_test_address(uint8_t addr);
  *
  * Funkcia vykoná typickú sekvenciu čítania z „register-based“ I2C zariadenia:
  *  - odošle SLA+W a po ňom počiatočnú adresu @p memaddr,
- *  - opätovne odošle Start a SLA+R,
+ *  - odošle opakovaný Start a SLA+R,
  *  - prečíta @p nbytes bajtov do @p buf.
  *
  * Používa sa napríklad pri čítaní z pamäťových zariadení, senzorov s
@@ -213,9 +531,144 @@ uint8_t twi_test_address(uint8_t addr);
  * @param buf     Ukazovateľ na buffer, do ktorého sa majú zapisovať prijaté dáta.
  * @param nbytes  Počet bajtov, ktoré sa majú prečítať.
  *
- * @return Funkcia nevracia žiadnu hodnotu.
+ * @return Stav transakcie (@ref TWI_XF_OK, @ref TWI_XF_NACK_ADDR, …).
+ */
+uint8_t twi_readfrom_mem_into(uint8_t addr, uint8_t memaddr, volatile uint8_t *buf, uint8_t nbytes);
+
+
+/**
+ * @brief Príznak obsadenej zbernice.
+ *
+ * Je 1 od @ref twi_start po @ref twi_stop a počas behu transakcií
+ * z fronty (@ref twi_submit).
+ */
+extern volatile uint8_t twi_busy;
+
+
+/**
+ * @brief Zaradí transakciu do fronty; prenos beží v prerušení TWI_vect.
+ *
+ * Ak je zbernica voľná, transakcia sa spustí hneď, inak po bežiacej
+ * transakcii (alebo jej úseku) podľa priority (pozri @ref TWI_PRIO_HIGH)
+ * alebo po @ref twi_stop bajtového prístupu.
+ * Dá sa volať aj z obsluhy iného prerušenia.
+ *
+ * @param x Popisovač transakcie.
+ *
+ * @return 0 = zaradená, 1 = fronta je plná alebo @p x ešte nie je dokončená.
+ */
+uint8_t twi_submit(twi_xfer_t *x);
+
+
+/**
+ * @brief Zistí, či je transakcia dokončená.
+ *
+ * @param x Popisovač transakcie.
+ *
+ * @return Nenulové, ak transakcia nečaká ani nebeží.
  */
-void twi_readfrom_mem_into(uint8_t addr, uint8_t memaddr, volatile uint8_t *buf, uint8_t nbytes);
+static inline uint8_t twi_done(const twi_xfer_t *x)
+{
+    return !(x->status & TWI_XF_PENDING);
+}
+
+
+/**
+ * @brief Počká na dokončenie transakcie @p x.
+ *
+ * Čakanie je ohraničené: transakcia, ktorá dlhšie ako @ref TWI_TIMEOUT_US
+ * neurobí krok, skončí stavom @ref TWI_XF_TIMEOUT.
+ *
+ * @param x Popisovač transakcie.
+ *
+ * @return Výsledný stav (@ref TWI_XF_OK, @ref TWI_XF_NACK_ADDR, …).
+ */
+uint8_t twi_wait(twi_xfer_t *x);
+
+
+/**
+ * @brief Zaradí transakciu do fronty; kým je fronta plná alebo @p x nedokončená, čaká (ohraničene).
+ *
+ * @param x Popisovač transakcie.
+ */
+void twi_submit_wait(twi_xfer_t *x);
+
+
+/**
+ * @brief Blokujúca transakcia – zaradí @p x do fronty a počká na jej dokončenie.
+ *
+ * Pri zakázaných prerušeniach (napr. pred sei) posúva prenos sama
+ * čítaním TWINT, takže funguje v každom kontexte okrem obsluhy prerušenia
+ * čakajúcej na vlastnú predošlú transakciu.
+ *
+ * @param x Popisovač transakcie.
+ *
+ * @return Výsledný stav (@ref TWI_XF_OK, @ref TWI_XF_NACK_ADDR, …,
+ *         @ref TWI_XF_TIMEOUT).
+ */
+uint8_t twi_transfer(twi_xfer_t *x);
+
+
+/**
+ * @brief Nastaví rozpočet snímky pre transakcie @ref TWI_PRIO_LOW.
+ *
+ * Po prenesení @p bytes bajtov nízkej priority od posledného
+ * @ref twi_sched_frame sa ďalšie transakcie (a úseky @ref TWI_XF_CHUNK)
+ * nízkej priority odložia do ďalšej snímky a zbernica ostane voľná pre tuner.
+ *
+ * @param bytes Bajty na snímku, 0 = bez obmedzenia.
+ *
+ * @note Pri rozpočte musí @ref twi_sched_frame volať prerušenie časovača,
+ *       inak by čakanie na odloženú transakciu neskončilo.
+ */
+void twi_sched_budget(uint16_t bytes);
+
+
+/**
+ * @brief Začne novú snímku – obnoví rozpočet nízkej priority a spustí odložené transakcie.
+ *
+ * Dá sa volať aj z obsluhy prerušenia.
+ */
+void twi_sched_frame(void);
+
+
+/**
+ * @brief Skopíruje štatistiku plánovača pre triedu @p prio.
+ *
+ * @param prio @ref TWI_PRIO_HIGH alebo @ref TWI_PRIO_LOW.
+ * @param st   Výstup.
+ */
+void twi_sched_get_stats(uint8_t prio, twi_sched_stats_t *st);
+
+
+/**
+ * @brief Vynuluje štatistiku plánovača.
+ */
+void twi_sched_clear_stats(void);
+
+
+#if TWI_TRACE
+/**
+ * @brief Časová značka pre tracer v tikoch @ref TWI_TRACE_TICK_US.
+ *
+ * Implementuje aplikácia (volá sa aj z prerušenia TWI_vect).
+ *
+ * @return Monotónny čas v tikoch.
+ */
+uint32_t twi_trace_clock(void);
+
+
+/**
+ * @brief Vypíše záznamy tracera v binárnom formáte a uvoľní ich z buffra.
+ *
+ * Vypíšu sa záznamy, ktoré sú v buffri pri zavolaní; novšie ostanú
+ * na ďalší výpis. Ak nie je čo hlásiť (žiadny záznam ani zahodený
+ * záznam), nevypíše sa nič.
+ *
+ * @param put Funkcia na odoslanie jedného bajtu (napr. uart_putc).
+ */
+void twi_trace_dump(void (*put)(unsigned char));
+#endif
 
 /** @} */  /* koniec skupiny fryza_twi */
 
@@ -0,0 +1,203 @@
+/**
+ * @file
+ * @brief Implementácia 3-wire rozhrania Si4703 (programovo alebo cez SPI).
+ *
+ * Všetky zmeny SEN a SDIO prebiehajú pri SCLK = 0, čip vzorkuje
+ * na nábežnej hrane SCLK. Pri @ref WIRE3_SPI sa piny SCK/MOSI prepínajú
+ * medzi SPI (SPE = 1) a portom (SPE = 0) – port drží SCLK v nule, takže
+ * prepnutie nevytvorí hranu.
+ */
+
+// -- Includes -------------------------------------------------------
+#include <wire3.h>
+
+
+// -- Defines --------------------------------------------------------
+#define W3_DDR (*(&WIRE3_PORT - 1))     /* DDR register portu WIRE3_PORT */
+#define W3_PIN (*(&WIRE3_PORT - 2))     /* PIN register portu WIRE3_PORT */
+
+#define W3_SEN  (1<<WIRE3_SEN_PIN)
+#define W3_SDIO (1<<WIRE3_SDIO_PIN)
+#define W3_MISO (1<<WIRE3_MISO_PIN)
+#define W3_SCLK (1<<WIRE3_SCLK_PIN)
+
+/* Riadiace slovo bez A7 (= 0): A6:A5 = 11, R/W, A4 = 0, A3:A0 */
+#define W3_CTRL(read, reg) (0xC0 | ((read) ? 0x20 : 0) | ((reg) & 0x0F))
+
+/* SPI master, f_CPU / 8 (SPR0 + SPI2X); CPHA sa mení podľa smeru */
+#define W3_SPCR ((1<<SPE) | (1<<MSTR) | (1<<SPR0))
+
+
+// -- Variables ------------------------------------------------------
+static uint8_t w3_mode = WIRE3_GPIO;    /* spôsob prenosu (WIRE3_GPIO / WIRE3_SPI) */
+
+
+// -- Local functions ------------------------------------------------
+
+/**
+ * @brief Jedna hodina SCLK (0 → 1 → 0).
+ */
+static inline void w3_clock(void)
+{
+    WIRE3_PORT |= W3_SCLK;
+    WIRE3_PORT &= ~W3_SCLK;
+}
+
+
+/**
+ * @brief Programovo vyšle @p bits najvyšších bitov bajtu @p data.
+ */
+static void w3_shift_out(uint8_t data, uint8_t bits)
+{
+    while (bits--) {
+        if (data & 0x80) WIRE3_PORT |= W3_SDIO;
+        else             WIRE3_PORT &= ~W3_SDIO;
+        w3_clock();
+        data <<= 1;
+    }
+}
+
+
+/**
+ * @brief Programovo prečíta 8 bitov (čip posúva na nábežnej hrane, číta sa po zostupnej).
+ */
+static uint8_t w3_shift_in(void)
+{
+    uint8_t data = 0;
+
+    for (uint8_t i = 0; i < 8; i++) {
+        w3_clock();
+        data = (data << 1) | ((W3_PIN & W3_SDIO) ? 1 : 0);
+    }
+    return data;
+}
+
+
+/**
+ * @brief Posunie jeden bajt cez SPI.
+ *
+ * @param cpha 0 = zápis (dáta platné pred nábežnou hranou), 1 = čítanie (vzorkovanie na zostupnej).
+ */
+static uint8_t w3_spi(uint8_t data, uint8_t cpha)
+{
+    SPCR = W3_SPCR | (cpha ? (1<<CPHA) : 0);
+    SPDR = data;
+    while (!(SPSR & (1<<SPIF)));
+    return SPDR;
+}
+
+
+/**
+ * @brief Začiatok rámca: SEN = 0 a riadiace slovo (9 bitov).
+ */
+static void w3_begin(uint8_t read, uint8_t reg)
+{
+    WIRE3_PORT &= ~W3_SEN;
+
+    if (w3_mode == WIRE3_SPI) {
+        w3_shift_out(0x00, 1);                  /* A7 = 0 programovo */
+        w3_spi(W3_CTRL(read, reg), 0);          /* A6 … A0 cez SPI */
+        SPCR = 0;                               /* piny späť portu (SCLK = 0) */
+    } else {
+        w3_shift_out(0x00, 1);
+        w3_shift_out(W3_CTRL(read, reg), 8);
+    }
+}
+
+
+/**
+ * @brief Koniec rámca: SEN = 1 a jedna hodina.
+ */
+static void w3_end(void)
+{
+    WIRE3_PORT |= W3_SEN;
+    w3_clock();
+}
+
+
+// -- Functions ------------------------------------------------------
+
+/**
+ * @brief Pripraví piny pred resetom čipu (SEN = 1, SDIO = 1 → 3-wire).
+ */
+void wire3_select(void)
+{
+    WIRE3_PORT |= W3_SEN | W3_SDIO;
+    WIRE3_PORT &= ~W3_SCLK;
+    W3_DDR |= W3_SEN | W3_SDIO | W3_SCLK;
+}
+
+
+/**
+ * @brief Inicializuje 3-wire rozhranie.
+ *
+ * @param mode @ref WIRE3_GPIO alebo @ref WIRE3_SPI.
+ */
+void wire3_init(uint8_t mode)
+{
+    w3_mode = mode;
+    wire3_select();
+
+    if (mode == WIRE3_SPI) {
+        W3_DDR &= ~W3_MISO;
+        SPSR = (1<<SPI2X);                      /* f_CPU / 8 = 2 MHz */
+        SPCR = 0;                               /* SPI sa zapína len počas bajtov */
+    }
+}
+
+
+/**
+ * @brief Prečíta jeden register.
+ *
+ * @param reg Adresa registra 0x00–0x0F.
+ *
+ * @return Obsah registra.
+ */
+uint16_t wire3_read(uint8_t reg)
+{
+    uint8_t hi, lo;
+
+    w3_begin(1, reg);
+
+    /* Otočenie zbernice – SDIO preberá čip */
+    W3_DDR &= ~W3_SDIO;
+    WIRE3_PORT &= ~W3_SDIO;
+    w3_clock();
+
+    if (w3_mode == WIRE3_SPI) {
+        hi = w3_spi(0xFF, 1);
+        lo = w3_spi(0xFF, 1);
+        SPCR = 0;
+    } else {
+        hi = w3_shift_in();
+        lo = w3_shift_in();
+    }
+
+    w3_end();
+    WIRE3_PORT |= W3_SDIO;
+    W3_DDR |= W3_SDIO;
+    return ((uint16_t)hi << 8) | lo;
+}
+
+
+/**
+ * @brief Zapíše jeden register.
+ *
+ * @param reg  Adresa registra 0x00–0x0F.
+ * @param data Zapisovaná hodnota.
+ */
+void wire3_write(uint8_t reg, uint16_t data)
+{
+    w3_begin(0, reg);
+
+    if (w3_mode == WIRE3_SPI) {
+        w3_spi(data >> 8, 0);
+        w3_spi(data & 0xFF, 0);
+        SPCR = 0;
+    } else {
+        w3_shift_out(data >> 8, 8);
+        w3_shift_out(data & 0xFF, 8);
+    }
+
+    w3_end();
+}
@@ -0,0 +1,122 @@
+#ifndef WIRE3_H
+# define WIRE3_H
+
+/**
+ * @file
+ * @defgroup wire3 3-wire rozhranie Si4703 <wire3.h>
+ * @code #include <wire3.h> @endcode
+ *
+ * @brief 3-vodičové sériové rozhranie tunera Si4703 (SEN, SCLK, SDIO).
+ *
+ * Rámec má 26 hodín SCLK, čip vzorkuje na nábežnej hrane:
+ *  - riadiace slovo 9 bitov: A7:A5 = 011, R/W (1 = čítanie), A4 = 0, A3:A0 = register,
+ *  - zápis: 16 bitov dát (MSB prvý),
+ *  - čítanie: 1 hodina na otočenie SDIO, potom 16 bitov, ktoré čip posúva
+ *    na nábežnej hrane (číta sa po zostupnej),
+ *  - SEN = 1 a jedna hodina rámec ukončí.
+ *
+ * Na rozdiel od 2-wire sa dá čítať aj zapisovať ľubovoľný register
+ * samostatne a zbernica sa nedelí s OLED displejom (I2C).
+ *
+ * Dva spôsoby prenosu (@ref wire3_init):
+ *  - @ref WIRE3_GPIO – všetky hodiny programovo, ľubovoľné piny portu @ref WIRE3_PORT,
+ *  - @ref WIRE3_SPI – bajty riadiaceho slova a dát posúva SPI (2 MHz),
+ *    programovo sa generuje len prvý bit, otočenie a ukončenie rámca.
+ *    SCLK = PB5 (SCK), SDIO = PB3 (MOSI), SEN = PB2 (SS) a SDIO musí byť
+ *    prepojené aj s PB4 (MISO).
+ *
+ * Porovnanie priepustnosti pri 16 MHz (odhad z počtu taktov, bez réžie volaní):
+ * | Prenos              | 1 register (STATUSRSSI) | 8 registrov (shadow) | zápis 0x02–0x07 |
+ * |:--------------------|------------------------:|---------------------:|----------------:|
+ * | 2-wire, 100 kHz     |                 ~270 µs |             ~1530 µs |        ~1170 µs |
+ * | 2-wire, 400 kHz     |                  ~70 µs |              ~390 µs |         ~300 µs |
+ * | 3-wire, GPIO        |                  ~25 µs |              ~200 µs |         ~150 µs |
+ * | 3-wire, SPI 2 MHz   |                  ~16 µs |              ~130 µs |          ~95 µs |
+ *
+ * Skutočné časy vypíše pri štarte @c TWI_BENCH v main.cpp.
+ * @{
+ */
+
+// -- Includes -------------------------------------------------------
+#include <avr/io.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// -- Defines --------------------------------------------------------
+/** @brief Prenos programovým generovaním všetkých hodín. */
+#define WIRE3_GPIO 0
+/** @brief Prenos hardvérovým SPI (piny PB2–PB5). */
+#define WIRE3_SPI 1
+
+/** @brief Port pinov 3-wire rozhrania (pri @ref WIRE3_SPI musí byť PORTB). */
+#ifndef WIRE3_PORT
+# define WIRE3_PORT PORTB
+#endif
+
+/** @brief Pin SEN (výber čipu, aktívna nula). */
+#ifndef WIRE3_SEN_PIN
+# define WIRE3_SEN_PIN 2
+#endif
+
+/** @brief Pin SDIO (obojsmerné dáta). */
+#ifndef WIRE3_SDIO_PIN
+# define WIRE3_SDIO_PIN 3
+#endif
+
+/** @brief Pin MISO prepojený so SDIO (len @ref WIRE3_SPI). */
+#ifndef WIRE3_MISO_PIN
+# define WIRE3_MISO_PIN 4
+#endif
+
+/** @brief Pin SCLK (hodiny). */
+#ifndef WIRE3_SCLK_PIN
+# define WIRE3_SCLK_PIN 5
+#endif
+
+
+// -- Function prototypes --------------------------------------------
+
+/**
+ * @brief Pripraví piny pred resetom čipu: SEN = 1, SDIO = 1, SCLK = 0.
+ *
+ * Si4703 pri nábežnej hrane RST so SEN = 1 a SDIO = 1 zvolí 3-wire režim.
+ */
+void wire3_select(void);
+
+
+/**
+ * @brief Inicializuje 3-wire rozhranie (po uvoľnení resetu čipu).
+ *
+ * @param mode @ref WIRE3_GPIO alebo @ref WIRE3_SPI.
+ */
+void wire3_init(uint8_t mode);
+
+
+/**
+ * @brief Prečíta jeden register.
+ *
+ * @param reg Adresa registra 0x00–0x0F.
+ *
+ * @return Obsah registra.
+ */
+uint16_t wire3_read(uint8_t reg);
+
+
+/**
+ * @brief Zapíše jeden register.
+ *
+ * @param reg  Adresa registra 0x00–0x0F.
+ * @param data Zapisovaná hodnota.
+ */
+void wire3_write(uint8_t reg, uint16_t data);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
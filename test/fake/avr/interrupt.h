@@ -0,0 +1,22 @@
+/**
+ * @file interrupt.h
+ * @brief Náhrada <avr/interrupt.h> pre natívne testy – ISR ako obyčajná funkcia, cli/sei menia SREG.
+ *
+ * Pri vypnutých prerušeniach posúva twi.c transakcie sám vo svojich
+ * čakacích slučkách (twi_poll), testy preto bežia s I = 0.
+ */
+#ifndef FAKE_AVR_INTERRUPT_H
+#define FAKE_AVR_INTERRUPT_H
+
+#include <avr/io.h>
+
+#ifdef __cplusplus
+# define ISR(vector, ...) extern "C" void vector(void); extern "C" void vector(void)
+#else
+# define ISR(vector, ...) void vector(void); void vector(void)
+#endif
+
+#define sei() (SREG |= (1 << SREG_I))
+#define cli() (SREG &= (uint8_t)~(1 << SREG_I))
+
+#endif
@@ -0,0 +1,103 @@
+/**
+ * @file io.h
+ * @brief Náhrada <avr/io.h> pre natívne testy (env:native) – registre ATmega328P ako premenné.
+ *
+ * PINx, DDRx a PORTx ležia za sebou ako v I/O priestore, takže makrá
+ * PIN() a DDR() z twi.h fungujú rovnako ako na čipe. TWCR je prístup cez
+ * model TWI jednotky (@ref fake_twcr v fake_hw.h), ostatné registre sú
+ * obyčajné premenné. Prerušenia volá test priamo (napr. PCINT1_vect).
+ */
+#ifndef FAKE_AVR_IO_H
+#define FAKE_AVR_IO_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* PINx, DDRx, PORTx – v tomto poradí ako na ATmega328P */
+extern volatile uint8_t fake_io_b[3];
+extern volatile uint8_t fake_io_c[3];
+extern volatile uint8_t fake_io_d[3];
+
+extern volatile uint8_t SREG;
+extern volatile uint8_t TWBR, TWSR, TWDR, TWAR;
+extern volatile uint8_t PCICR, PCIFR, PCMSK0, PCMSK1, PCMSK2;
+extern volatile uint8_t SPCR, SPSR, SPDR;
+
+volatile uint8_t *fake_twcr(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define PINB  fake_io_b[0]
+#define DDRB  fake_io_b[1]
+#define PORTB fake_io_b[2]
+#define PINC  fake_io_c[0]
+#define DDRC  fake_io_c[1]
+#define PORTC fake_io_c[2]
+#define PIND  fake_io_d[0]
+#define DDRD  fake_io_d[1]
+#define PORTD fake_io_d[2]
+
+#define TWCR (*fake_twcr())
+
+#define _BV(b) (1 << (b))
+
+#define PB0 0
+#define PB1 1
+#define PB2 2
+#define PB3 3
+#define PB4 4
+#define PB5 5
+#define PB6 6
+#define PB7 7
+#define PC0 0
+#define PC1 1
+#define PC2 2
+#define PC3 3
+#define PC4 4
+#define PC5 5
+#define PC6 6
+#define PD0 0
+#define PD1 1
+#define PD2 2
+#define PD3 3
+#define PD4 4
+#define PD5 5
+#define PD6 6
+#define PD7 7
+
+#define SREG_I 7
+
+#define TWINT 7
+#define TWEA  6
+#define TWSTA 5
+#define TWSTO 4
+#define TWWC  3
+#define TWEN  2
+#define TWIE  0
+#define TWPS1 1
+#define TWPS0 0
+
+#define PCIE0 0
+#define PCIE1 1
+#define PCIE2 2
+
+#define SPIE  7
+#define SPE   6
+#define DORD  5
+#define MSTR  4
+#define CPOL  3
+#define CPHA  2
+#define SPR1  1
+#define SPR0  0
+#define SPIF  7
+#define SPI2X 0
+
+#define TWI_vect    fake_twi_vect
+#define PCINT1_vect fake_pcint1_vect
+
+#endif
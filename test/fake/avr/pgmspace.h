@@ -0,0 +1,19 @@
+/**
+ * @file pgmspace.h
+ * @brief Náhrada <avr/pgmspace.h> pre natívne testy – flash je obyčajná pamäť.
+ */
+#ifndef FAKE_AVR_PGMSPACE_H
+#define FAKE_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(a) (*(const uint8_t *)(a))
+#define pgm_read_word(a) (*(const uint16_t *)(a))
+#define strcpy_P   strcpy
+#define snprintf_P snprintf
+
+#endif
@@ -0,0 +1,248 @@
+/**
+ * @file fake_hw.h
+ * @brief Model ATmega328P pre natívne testy: registre, simulovaný čas, linky SDA/SCL a TWI jednotka.
+ *
+ * Test ho vkladá raz, za zdrojové súbory, ktoré testuje (napr. twi.c,
+ * Si4703.cpp). Obsahuje:
+ *  - definície registrov z náhradného <avr/io.h>,
+ *  - simulovaný čas – posúva ho len @ref fake_delay_us (všetky _delay_us/_delay_ms),
+ *    @c timer_millis ho vracia v ms,
+ *  - linky SDA/SCL portu C: pri vypnutej TWI jednotke ich ovláda DDRC/PORTC
+ *    (obnova zbernice v twi.c), slave môže držať SDA v nule niekoľko hodín SCL,
+ *  - TWI jednotku: príkaz zapísaný do TWCR sa vykoná pri ďalšom prístupe
+ *    k TWCR a nastaví TWINT a stavový kód v TWSR ako na čipe,
+ *  - chyby na požiadanie (@ref fake_bus): NACK adresy/dát, zaseknutá jednotka.
+ *
+ * Zariadenia na zbernici sa pripájajú cez @ref fake_bus_attach
+ * (fake_si4703.h, fake_ssd1306.h).
+ */
+#ifndef FAKE_HW_H
+#define FAKE_HW_H
+
+#include <stdint.h>
+#include <string.h>
+#include <avr/io.h>
+
+extern "C" {
+volatile uint8_t fake_io_b[3], fake_io_c[3], fake_io_d[3];
+volatile uint8_t SREG;
+volatile uint8_t TWBR, TWSR, TWDR, TWAR;
+volatile uint8_t PCICR, PCIFR, PCMSK0, PCMSK1, PCMSK2;
+volatile uint8_t SPCR, SPSR, SPDR;
+}
+
+/// Simulovaný čas od štartu v µs.
+static unsigned long fake_us = 0;
+
+/**
+ * @brief Čas v ms od štartu (v aplikácii ho dodáva main.cpp).
+ */
+unsigned long timer_millis()
+{
+    return fake_us / 1000;
+}
+
+/** @brief Zariadenie na zbernici (slave) – volania pri adrese, bajtoch a STOP. */
+typedef struct {
+    uint8_t addr;                           ///< 7-bitová adresa.
+    bool    (*start)(bool rd);              ///< SLA+R/W; @c false = NACK.
+    bool    (*write)(uint8_t b);            ///< Zapísaný bajt; @c false = NACK.
+    uint8_t (*read)(void);                  ///< Bajt pre master.
+    void    (*stop)(void);                  ///< STOP alebo opakovaný START.
+    void    (*tick)(void);                  ///< Po každom posune času (môže byť NULL).
+} fake_slave_t;
+
+/** @brief Stav zbernice a chyby na požiadanie. */
+static struct {
+    const fake_slave_t *slaves[4];          ///< Pripojené zariadenia.
+    const fake_slave_t *cur;                ///< Zariadenie adresované v bežiacom prenose.
+    uint8_t  twcr;                          ///< Obsah TWCR.
+    uint8_t  phase;                         ///< 0 = nič, 1 = čaká sa SLA, 2 = zápis, 3 = čítanie.
+    bool     owned;                         ///< Master drží zbernicu (po START, pred STOP).
+    uint8_t  data_pos;                      ///< Poradie dátového bajtu v prenose.
+
+    uint8_t  nack_addr;                     ///< Koľko najbližších adries odmietnuť (NACK).
+    int16_t  nack_data_at;                  ///< Dátový bajt prenosu, ktorý sa odmietne (-1 = žiadny).
+    bool     hang;                          ///< Jednotka sa zasekla – TWINT ani STOP nedobehnú.
+    uint8_t  sda_hold;                      ///< Slave drží SDA v nule ešte toľko hodín SCL.
+    bool     scl_stuck;                     ///< SCL trvalo v nule.
+    uint8_t  pinc_low;                      ///< Ďalšie piny portu C v nule (napr. GPIO2 tunera).
+
+    bool     scl_prev;                      ///< Posledný stav SCL (hrany pri obnove).
+    uint16_t scl_clocks;                    ///< Nábežné hrany SCL pri vypnutej TWI jednotke.
+    uint32_t bytes;                         ///< Bajty na zbernici (adresa + dáta).
+    uint16_t xfers;                         ///< Počet adresných fáz (transakcií).
+} fake_bus;
+
+/// Bit 1 TWCR je na čipe rezervovaný (číta sa 0) – tu značí „príkaz už vykonaný“.
+#define FAKE_TWCR_DONE 0x02
+
+/**
+ * @brief Obnoví PINC z liniek SDA/SCL a pinov, ktoré držia zariadenia.
+ */
+static void fake_pins_update(void)
+{
+    uint8_t low = fake_bus.pinc_low;
+    bool twi_on = fake_bus.twcr & (1 << TWEN);
+
+    if (!twi_on && (DDRC & (1 << PC4)) && !(PORTC & (1 << PC4))) low |= 1 << PC4;
+    if (!twi_on && (DDRC & (1 << PC5)) && !(PORTC & (1 << PC5))) low |= 1 << PC5;
+    if (fake_bus.sda_hold)  low |= 1 << PC4;
+    if (fake_bus.scl_stuck) low |= 1 << PC5;
+
+    bool scl = !(low & (1 << PC5));
+    if (!twi_on && scl && !fake_bus.scl_prev) {
+        fake_bus.scl_clocks++;
+        if (fake_bus.sda_hold) {
+            fake_bus.sda_hold--;                // slave dokončil bit
+            if (!fake_bus.sda_hold) low &= ~(1 << PC4);
+        }
+    }
+    fake_bus.scl_prev = scl;
+    PINC = (uint8_t)~low;
+}
+
+extern "C" void fake_delay_us(uint32_t us)
+{
+    fake_us += us;
+    for (uint8_t i = 0; i < 4; i++)
+        if (fake_bus.slaves[i] && fake_bus.slaves[i]->tick) fake_bus.slaves[i]->tick();
+    fake_pins_update();
+}
+
+/**
+ * @brief Pripojí zariadenie na zbernicu.
+ */
+static void fake_bus_attach(const fake_slave_t *s)
+{
+    for (uint8_t i = 0; i < 4; i++)
+        if (!fake_bus.slaves[i] || fake_bus.slaves[i] == s) {
+            fake_bus.slaves[i] = s;
+            return;
+        }
+}
+
+/**
+ * @brief Vráti zbernicu do kľudu: bez chýb, bez počítadiel, zariadenia ostávajú pripojené.
+ */
+static void fake_bus_reset(void)
+{
+    const fake_slave_t *slaves[4];
+
+    memcpy(slaves, fake_bus.slaves, sizeof(slaves));
+    memset(&fake_bus, 0, sizeof(fake_bus));
+    memcpy(fake_bus.slaves, slaves, sizeof(slaves));
+    fake_bus.nack_data_at = -1;
+    fake_bus.scl_prev = true;
+    fake_pins_update();
+}
+
+/**
+ * @brief Nastaví stavový kód TWSR (pred-deľač v bitoch 1:0 ostáva).
+ */
+static void fake_twi_status(uint8_t status)
+{
+    TWSR = (uint8_t)(status | (TWSR & 0x03));
+}
+
+/**
+ * @brief Ukončí prenos s adresovaným zariadením (STOP alebo opakovaný START).
+ */
+static void fake_twi_release(void)
+{
+    if (fake_bus.cur && fake_bus.cur->stop) fake_bus.cur->stop();
+    fake_bus.cur = 0;
+}
+
+/**
+ * @brief Vykoná príkaz zapísaný do TWCR (START, STOP, SLA, dátový bajt).
+ */
+static void fake_twi_exec(void)
+{
+    uint8_t v = fake_bus.twcr;
+
+    if (!(v & (1 << TWEN))) {                   // vypnutá jednotka – piny ovláda PORT/DDR
+        fake_twi_release();
+        fake_bus.owned = false;
+        fake_bus.phase = 0;
+        fake_bus.twcr  = v | FAKE_TWCR_DONE;
+        return;
+    }
+    if (fake_bus.hang || fake_bus.scl_stuck) {  // nič nedobehne
+        fake_bus.twcr = (v & ~(1 << TWINT)) | FAKE_TWCR_DONE;
+        return;
+    }
+    if (v & (1 << TWSTO)) {
+        fake_twi_release();
+        fake_bus.owned = false;
+        fake_bus.phase = 0;
+        v &= ~(1 << TWSTO);
+        if (!(v & (1 << TWSTA))) {              // STOP nenastavuje TWINT
+            fake_bus.twcr = (v & ~(1 << TWINT)) | FAKE_TWCR_DONE;
+            return;
+        }
+    }
+    if (v & (1 << TWSTA)) {
+        fake_twi_release();
+        fake_twi_status(fake_bus.owned ? 0x10 : 0x08);
+        fake_bus.owned = true;
+        fake_bus.phase = 1;
+        fake_bus.twcr  = v | (1 << TWINT) | FAKE_TWCR_DONE;
+        return;
+    }
+    if (!(v & (1 << TWINT))) {                  // zápis bez TWINT nič nespúšťa
+        fake_bus.twcr = v | FAKE_TWCR_DONE;
+        return;
+    }
+
+    switch (fake_bus.phase) {
+    case 1: {                                   // SLA+R/W
+        uint8_t sla = TWDR;
+        bool rd  = sla & 1;
+        bool ack = false;
+
+        fake_bus.bytes++;
+        fake_bus.xfers++;
+        fake_bus.data_pos = 0;
+        for (uint8_t i = 0; i < 4; i++)
+            if (fake_bus.slaves[i] && fake_bus.slaves[i]->addr == (sla >> 1))
+                fake_bus.cur = fake_bus.slaves[i];
+        if (fake_bus.nack_addr)
+            fake_bus.nack_addr--;
+        else if (fake_bus.cur)
+            ack = fake_bus.cur->start(rd);
+        if (!ack) fake_bus.cur = 0;
+        fake_bus.phase = ack ? (rd ? 3 : 2) : 0;
+        fake_twi_status(rd ? (ack ? 0x40 : 0x48) : (ack ? 0x18 : 0x20));
+        break;
+    }
+    case 2: {                                   // dátový bajt od mastra
+        bool ack = fake_bus.cur->write(TWDR);
+
+        fake_bus.bytes++;
+        if (fake_bus.data_pos++ == fake_bus.nack_data_at) ack = false;
+        fake_twi_status(ack ? 0x28 : 0x30);
+        break;
+    }
+    case 3:                                     // dátový bajt pre mastra
+        TWDR = fake_bus.cur->read();
+        fake_bus.bytes++;
+        fake_twi_status((v & (1 << TWEA)) ? 0x50 : 0x58);
+        break;
+    default:
+        fake_twi_status(0x00);                  // chyba zbernice
+        break;
+    }
+    fake_bus.twcr = v | (1 << TWINT) | FAKE_TWCR_DONE;
+}
+
+/**
+ * @brief Prístup k TWCR – najprv vykoná príkaz, ktorý doň program zapísal.
+ */
+extern "C" volatile uint8_t *fake_twcr(void)
+{
+    if (!(fake_bus.twcr & FAKE_TWCR_DONE)) fake_twi_exec();
+    return &fake_bus.twcr;
+}
+
+#endif
@@ -0,0 +1,185 @@
+/**
+ * @file fake_si4703.h
+ * @brief Model tunera Si4703 na zbernici (2-wire, adresa 0x10) s linkou GPIO2 na PC2.
+ *
+ * Registre podľa AN230: zápis začína registrom 0x02, čítanie registrom
+ * 0x0A (po 0x0F pokračuje 0x00), MSB prvý. Nastavenie TUNE alebo SEEK
+ * spustí ladenie, ktoré po @c tune_ms / @c seek_ms nastaví STC a pri
+ * povolenom prerušení (STCIEN, GPIO2 = 01) stiahne GPIO2 na 5 ms do nuly.
+ * Vynulovanie TUNE/SEEK vynuluje STC hneď. Zostupnú hranu doručí
+ * @ref fake_si_irq ako pin-change prerušenie PCINT1 – test ho volá medzi
+ * volaniami ovládača (@ref fake_run_ms), nie uprostred nich.
+ *
+ * Vkladá sa za fake_hw.h a za Si4703.cpp (volá jeho PCINT1_vect).
+ */
+#ifndef FAKE_SI4703_H
+#define FAKE_SI4703_H
+
+#include "fake_hw.h"
+
+/** @brief Stav modelu Si4703. */
+static struct {
+    uint16_t reg[16];                       ///< Registre 0x00–0x0F.
+    uint8_t  pos;                           ///< Ďalší register prenosu.
+    bool     lo;                            ///< Nasleduje dolný bajt registra.
+    uint16_t reads;                         ///< Potvrdené čítacie transakcie.
+    uint16_t writes;                        ///< Potvrdené zápisové transakcie.
+
+    uint16_t tune_ms;                       ///< Trvanie tuningu do STC.
+    uint16_t seek_ms;                       ///< Trvanie seeku do STC.
+    uint16_t seek_chan;                     ///< Kanál, na ktorom seek skončí.
+    bool     irq_lost;                      ///< Impulz GPIO2 sa stratí (nepríde hrana).
+    unsigned long stc_at;                   ///< Čas STC v ms (0 = nebeží ladenie).
+    unsigned long gpio2_until;              ///< GPIO2 v nule do tohto času (ms).
+    bool     edge;                          ///< Nedoručená zostupná hrana GPIO2.
+} fake_si;
+
+#define FAKE_SI_POWERCFG   0x02
+#define FAKE_SI_CHANNEL    0x03
+#define FAKE_SI_SYSCONFIG1 0x04
+#define FAKE_SI_STATUSRSSI 0x0A
+#define FAKE_SI_READCHAN   0x0B
+
+#define FAKE_SI_SEEK  (1u << 8)             ///< POWERCFG
+#define FAKE_SI_TUNE  (1u << 15)            ///< CHANNEL
+#define FAKE_SI_STC   (1u << 14)            ///< STATUSRSSI
+#define FAKE_SI_CHAN  0x03FFu               ///< CHANNEL, READCHAN
+
+/**
+ * @brief Spracuje zapísané riadiace registre (štart/ukončenie ladenia).
+ */
+static void fake_si_control(void)
+{
+    bool tune = fake_si.reg[FAKE_SI_CHANNEL] & FAKE_SI_TUNE;
+    bool seek = fake_si.reg[FAKE_SI_POWERCFG] & FAKE_SI_SEEK;
+    unsigned long now = timer_millis();
+
+    if (!tune && !seek) {
+        fake_si.reg[FAKE_SI_STATUSRSSI] &= ~FAKE_SI_STC;
+        fake_si.stc_at = 0;
+    } else if (!fake_si.stc_at && !(fake_si.reg[FAKE_SI_STATUSRSSI] & FAKE_SI_STC)) {
+        fake_si.stc_at = now + (seek ? fake_si.seek_ms : fake_si.tune_ms);
+    }
+}
+
+static bool fake_si_start(bool rd)
+{
+    fake_si.pos = rd ? FAKE_SI_STATUSRSSI : FAKE_SI_POWERCFG;
+    fake_si.lo  = false;
+    if (rd) fake_si.reads++;
+    else    fake_si.writes++;
+    return true;
+}
+
+static bool fake_si_write(uint8_t b)
+{
+    uint16_t *r = &fake_si.reg[fake_si.pos & 0x0F];
+
+    if (!fake_si.lo) {
+        *r = (uint16_t)((*r & 0x00FF) | (b << 8));
+    } else {
+        *r = (uint16_t)((*r & 0xFF00) | b);
+        fake_si.pos++;
+        fake_si_control();
+    }
+    fake_si.lo = !fake_si.lo;
+    return true;
+}
+
+static uint8_t fake_si_read(void)
+{
+    uint16_t r = fake_si.reg[fake_si.pos & 0x0F];
+
+    if (!fake_si.lo) {
+        fake_si.lo = true;
+        return r >> 8;
+    }
+    fake_si.lo = false;
+    fake_si.pos = (fake_si.pos + 1) & 0x0F;
+    return r & 0xFF;
+}
+
+static void fake_si_stop(void)
+{
+}
+
+/**
+ * @brief Posun času: dokončenie ladenia (STC) a impulz GPIO2.
+ */
+static void fake_si_tick(void)
+{
+    unsigned long now = timer_millis();
+
+    if (fake_si.stc_at && now >= fake_si.stc_at) {
+        bool seek = fake_si.reg[FAKE_SI_POWERCFG] & FAKE_SI_SEEK;
+        uint16_t chan = seek ? fake_si.seek_chan : (fake_si.reg[FAKE_SI_CHANNEL] & FAKE_SI_CHAN);
+        uint16_t cfg  = fake_si.reg[FAKE_SI_SYSCONFIG1];
+
+        fake_si.stc_at = 0;
+        fake_si.reg[FAKE_SI_STATUSRSSI] |= FAKE_SI_STC;
+        fake_si.reg[FAKE_SI_READCHAN] = (fake_si.reg[FAKE_SI_READCHAN] & ~FAKE_SI_CHAN) | chan;
+        if ((cfg & (1u << 14)) && ((cfg >> 2) & 0x03) == 0x01 && !fake_si.irq_lost) {
+            fake_si.gpio2_until = now + 5;      // STC impulz, min. 5 ms
+            fake_si.edge = true;
+        }
+    }
+    if (now < fake_si.gpio2_until) fake_bus.pinc_low |= 1 << PC2;
+    else                           fake_bus.pinc_low &= ~(1 << PC2);
+}
+
+static const fake_slave_t fake_si_slave = {
+    0x10, fake_si_start, fake_si_write, fake_si_read, fake_si_stop, fake_si_tick
+};
+
+/**
+ * @brief Pripojí model na zbernicu so stavom po resete.
+ *
+ * @param tune_ms Trvanie tuningu do STC.
+ * @param seek_ms Trvanie seeku do STC.
+ */
+static void fake_si_reset(uint16_t tune_ms, uint16_t seek_ms)
+{
+    memset(&fake_si, 0, sizeof(fake_si));
+    fake_si.reg[0x00] = 0x1242;                 // DEVICEID
+    fake_si.reg[0x01] = 0x1253;                 // CHIPID (Si4703-C19)
+    fake_si.reg[0x07] = 0x0100;                 // TEST1 po resete
+    fake_si.tune_ms = tune_ms;
+    fake_si.seek_ms = seek_ms;
+    fake_si.seek_chan = 40;
+    fake_bus_attach(&fake_si_slave);
+}
+
+/**
+ * @brief Doručí zostupnú hranu GPIO2 ako pin-change prerušenie (ak je povolené).
+ */
+static void fake_si_irq(void)
+{
+    if (!fake_si.edge) return;
+    fake_si.edge = false;
+    if ((PCICR & (1 << PCIE1)) && (PCMSK1 & (1 << PC2)))
+        PCINT1_vect();
+}
+
+/**
+ * @brief Impulz GPIO2 mimo STC (napr. rušenie na linke) – doručí sa hneď.
+ */
+static inline void fake_si_pulse(void)
+{
+    fake_si.gpio2_until = timer_millis() + 5;
+    fake_si.edge = true;
+    fake_delay_us(0);                           // GPIO2 do nuly na PINC
+    fake_si_irq();
+}
+
+/**
+ * @brief Posunie čas o @p ms po 1 ms a po každom kroku doručí prerušenia.
+ */
+static inline void fake_run_ms(unsigned ms)
+{
+    while (ms--) {
+        fake_delay_us(1000);
+        fake_si_irq();
+    }
+}
+
+#endif
@@ -0,0 +1,195 @@
+/**
+ * @file fake_ssd1306.h
+ * @brief Model displeja SSD1306 na zbernici (adresa 0x3C): RAM displeja, okná a horizontálny posun.
+ *
+ * Prvý bajt transakcie je riadiaci: 0x00 = príkazy, 0x40 = dáta
+ * (s bitom Co = 0x80 platí len pre jeden bajt a potom nasleduje ďalší
+ * riadiaci bajt). Dáta sa zapisujú v horizontálnom adresovaní do okna
+ * 0x21/0x22, v stránkovom adresovaní podľa 0xB0–0xB7 a 0x00–0x1F.
+ *
+ * Posun 0x26/0x27 + 0x2F otáča stránky okna o stĺpec každých
+ * @c scroll_step_us µs simulovaného času (0 = posun stojí), 0x2E ho
+ * zastaví. Zápis dát počas posunu čip nedovoľuje – model ho vykoná,
+ * ale započíta do @c ram_viol.
+ *
+ * Vkladá sa za fake_hw.h.
+ */
+#ifndef FAKE_SSD1306_H
+#define FAKE_SSD1306_H
+
+#include "fake_hw.h"
+
+/** @brief Stav modelu SSD1306. */
+static struct {
+    uint8_t  gram[8][128];                  ///< RAM displeja [stránka][stĺpec].
+    int16_t  ctrl;                          ///< Riadiaci bajt (-1 = nasleduje riadiaci bajt).
+    int16_t  cmd;                           ///< Príkaz, ktorý čaká na argumenty (-1 = žiadny).
+    uint8_t  argc;                          ///< Počet argumentov, ktoré príkaz potrebuje.
+    uint8_t  argn;                          ///< Počet prijatých argumentov.
+    uint8_t  args[6];                       ///< Argumenty príkazu.
+    uint8_t  mode;                          ///< Adresovanie: 0 = horizontálne, 2 = stránkové.
+    uint8_t  col0, col1, page0, page1;      ///< Okno (0x21/0x22).
+    uint8_t  col, page;                     ///< Aktuálna adresa.
+
+    bool     scroll_on;                     ///< Posun beží (0x2F).
+    bool     scroll_left;                   ///< Smer posledného nastavenia (0x27 = doľava).
+    uint8_t  scroll_p0, scroll_p1;          ///< Posúvané stránky.
+    uint32_t scroll_step_us;                ///< Perióda kroku posunu (0 = posun stojí).
+    unsigned long scroll_last;              ///< Čas posledného kroku (µs).
+    uint16_t scroll_starts;                 ///< Počet spustení posunu.
+    uint16_t ram_viol;                      ///< Zápisy dát počas bežiaceho posunu.
+    uint32_t data_bytes;                    ///< Zapísané dátové bajty.
+} fake_oled;
+
+/**
+ * @brief Počet argumentov príkazu SSD1306.
+ */
+static uint8_t fake_oled_argc(uint8_t c)
+{
+    switch (c) {
+    case 0x26: case 0x27:                   return 6;
+    case 0x29: case 0x2A:                   return 5;
+    case 0x21: case 0x22: case 0xA3:        return 2;
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+    case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+                                            return 1;
+    default:                                return 0;
+    }
+}
+
+/**
+ * @brief Vykoná príkaz s prijatými argumentmi.
+ */
+static void fake_oled_exec(uint8_t c, const uint8_t *a)
+{
+    switch (c) {
+    case 0x20: fake_oled.mode = a[0] & 0x03; break;
+    case 0x21: fake_oled.col0  = fake_oled.col  = a[0] & 0x7F; fake_oled.col1  = a[1] & 0x7F; break;
+    case 0x22: fake_oled.page0 = fake_oled.page = a[0] & 0x07; fake_oled.page1 = a[1] & 0x07; break;
+    case 0x26:
+    case 0x27:
+        fake_oled.scroll_left = (c == 0x27);
+        fake_oled.scroll_p0   = a[1] & 0x07;
+        fake_oled.scroll_p1   = a[3] & 0x07;
+        break;
+    case 0x2E: fake_oled.scroll_on = false; break;
+    case 0x2F:
+        fake_oled.scroll_on   = true;
+        fake_oled.scroll_last = fake_us;
+        fake_oled.scroll_starts++;
+        break;
+    default:
+        if (c >= 0xB0 && c <= 0xB7)      fake_oled.page = c & 0x07;
+        else if (c <= 0x0F)              fake_oled.col  = (fake_oled.col & 0x70) | c;
+        else if (c >= 0x10 && c <= 0x17) fake_oled.col  = (uint8_t)((fake_oled.col & 0x0F) | ((c & 0x07) << 4));
+        break;
+    }
+}
+
+/**
+ * @brief Zapíše dátový bajt na aktuálnu adresu a posunie ju.
+ */
+static void fake_oled_data(uint8_t b)
+{
+    if (fake_oled.scroll_on) fake_oled.ram_viol++;
+    fake_oled.data_bytes++;
+    fake_oled.gram[fake_oled.page & 0x07][fake_oled.col & 0x7F] = b;
+
+    if (fake_oled.mode == 2) {                  // stránkové: len stĺpec, na konci stránky späť na 0
+        fake_oled.col = (fake_oled.col + 1) & 0x7F;
+        return;
+    }
+    if (fake_oled.col++ >= fake_oled.col1) {
+        fake_oled.col = fake_oled.col0;
+        if (fake_oled.page++ >= fake_oled.page1) fake_oled.page = fake_oled.page0;
+    }
+}
+
+static bool fake_oled_start(bool rd)
+{
+    fake_oled.ctrl = -1;
+    fake_oled.cmd  = -1;
+    return !rd;
+}
+
+static bool fake_oled_write(uint8_t b)
+{
+    if (fake_oled.ctrl < 0) {
+        fake_oled.ctrl = b;
+        return true;
+    }
+    bool once = fake_oled.ctrl & 0x80;          // Co = 1: po bajte ďalší riadiaci bajt
+
+    if (fake_oled.ctrl & 0x40) {
+        fake_oled_data(b);
+    } else if (fake_oled.cmd < 0) {
+        fake_oled.argc = fake_oled_argc(b);
+        fake_oled.argn = 0;
+        if (fake_oled.argc) fake_oled.cmd = b;
+        else                fake_oled_exec(b, fake_oled.args);
+    } else {
+        fake_oled.args[fake_oled.argn++] = b;
+        if (fake_oled.argn == fake_oled.argc) {
+            fake_oled_exec((uint8_t)fake_oled.cmd, fake_oled.args);
+            fake_oled.cmd = -1;
+        }
+    }
+    if (once) fake_oled.ctrl = -1;
+    return true;
+}
+
+static uint8_t fake_oled_read(void)
+{
+    return 0xFF;
+}
+
+static void fake_oled_stop(void)
+{
+}
+
+/**
+ * @brief Posun času: kroky horizontálneho posunu.
+ */
+static void fake_oled_tick(void)
+{
+    if (!fake_oled.scroll_on || !fake_oled.scroll_step_us) return;
+
+    while (fake_us - fake_oled.scroll_last >= fake_oled.scroll_step_us) {
+        fake_oled.scroll_last += fake_oled.scroll_step_us;
+        for (uint8_t p = fake_oled.scroll_p0; p <= fake_oled.scroll_p1; p++) {
+            uint8_t *r = fake_oled.gram[p];
+            if (fake_oled.scroll_left) {
+                uint8_t c = r[0];
+                memmove(r, r + 1, 127);
+                r[127] = c;
+            } else {
+                uint8_t c = r[127];
+                memmove(r + 1, r, 127);
+                r[0] = c;
+            }
+        }
+    }
+}
+
+static const fake_slave_t fake_oled_slave = {
+    0x3C, fake_oled_start, fake_oled_write, fake_oled_read, fake_oled_stop, fake_oled_tick
+};
+
+/**
+ * @brief Pripojí model na zbernicu so stavom po resete (RAM nulová, posun stojí).
+ *
+ * @param step_us Perióda kroku posunu v µs (0 = posun sa len zapína/vypína).
+ */
+static void fake_oled_reset(uint32_t step_us)
+{
+    memset(&fake_oled, 0, sizeof(fake_oled));
+    fake_oled.ctrl  = -1;
+    fake_oled.cmd   = -1;
+    fake_oled.mode  = 2;                        // po resete stránkové adresovanie
+    fake_oled.col1  = 127;
+    fake_oled.page1 = 7;
+    fake_oled.scroll_step_us = step_us;
+    fake_bus_attach(&fake_oled_slave);
+}
+
+#endif
@@ -0,0 +1,25 @@
+/**
+ * @file delay.h
+ * @brief Náhrada <util/delay.h> pre natívne testy – čakanie posunie simulovaný čas.
+ *
+ * Každé čakanie zavolá @ref fake_delay_us (fake_hw.h): posunie hodiny
+ * (timer_millis), modely zariadení a stav liniek SDA/SCL, takže obnova
+ * zbernice a časové limity ovládačov bežia ako na čipe, len bez čakania.
+ */
+#ifndef FAKE_UTIL_DELAY_H
+#define FAKE_UTIL_DELAY_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void fake_delay_us(uint32_t us);
+#ifdef __cplusplus
+}
+#endif
+
+static inline void _delay_us(double us) { fake_delay_us((uint32_t)us); }
+static inline void _delay_ms(double ms) { fake_delay_us((uint32_t)(ms * 1000)); }
+
+#endif
@@ -0,0 +1,222 @@
+/**
+ * @file test_oled_bench.cpp
+ * @brief Natívne meranie prevádzky displeja na zbernici (pio test -e native -v).
+ *
+ * oled.cpp a twi.c bežia proti modelu TWI (fake_hw.h) a SSD1306
+ * (fake_ssd1306.h). Bajty sa počítajú na zbernici – adresa, riadiaci
+ * bajt a dáta každej transakcie, vrátane opakovanej adresy pri delení
+ * na úseky. Namerané hodnoty sa vypíšu (TEST_MESSAGE, viditeľné s -v);
+ * testy strážia len vlastnosti, ktoré sa nesmú zhoršiť:
+ *  - mazanie zapíše každý stĺpec RAM práve raz (128 × 8),
+ *  - nezmenená frekvencia stojí 0 B, krok ladenia menej ako prvé kreslenie
+ *    (ak je frekvencia v buffri, @ref OLED_FB_PAGES),
+ *  - bežiaci riadok nezapisuje do RAM počas posunu (@c ram_viol) a drží sa
+ *    ideálneho obrazu, krátky text po zápise nestojí nič.
+ *
+ * Prepínače oled.h (napr. -DOLED_FB_PAGES=0) menia čísla rovnako ako vo firmvéri.
+ */
+#include "twi.c"
+#include "oled.cpp"
+
+#include "fake_ssd1306.h"
+#include <stdio.h>
+#include <unity.h>
+
+/// Frekvencia (stránky 3–4) je v buffri – jej nezmenené stĺpce sa neposielajú.
+#define FREQ_BUFFERED ((OLED_FB_PAGES & ((1 << 3) | (1 << 4))) == ((1 << 3) | (1 << 4)))
+
+/**
+ * @brief Počká, kým fronta TWI neodošle všetko, čo displej zaradil.
+ *
+ * Bajtový prístup (START bez adresy a STOP) čaká na prázdnu frontu
+ * a na zbernici nič nezapočíta.
+ */
+static void drain(void)
+{
+    twi_start();
+    twi_stop();
+}
+
+/** @brief Vypíše jeden riadok merania. */
+static void report(const char *label, uint32_t bytes, uint16_t xfers)
+{
+    char line[64];
+
+    snprintf(line, sizeof(line), "%-20s %5lu B %4u xfers", label, (unsigned long)bytes, xfers);
+    TEST_MESSAGE(line);
+}
+
+/// Meranie jedného volania: bajty a transakcie na zbernici po dokončení fronty.
+#define MEASURE(label, call, bytes_out)                         \
+    do {                                                        \
+        drain();                                                \
+        uint32_t _b0 = fake_bus.bytes;                          \
+        uint16_t _x0 = fake_bus.xfers;                          \
+        call;                                                   \
+        drain();                                                \
+        (bytes_out) = fake_bus.bytes - _b0;                     \
+        report(label, bytes_out, fake_bus.xfers - _x0);         \
+    } while (0)
+
+void setUp(void)
+{
+    fake_bus_reset();
+    fake_oled_reset(0);
+    SREG = 0;
+    twi_init();
+    twi_sched_clear_stats();
+    oled_init();
+    drain();
+}
+
+void tearDown(void)
+{
+}
+
+/**
+ * @brief Cena hlavnej obrazovky a jej prekreslení (merania k [user-019], [user-021], [user-022], [user-025]).
+ */
+void test_radio_screen_bytes(void)
+{
+    uint32_t b, d0, full, step;
+
+    MEASURE("splash",            oled_show_splash(), b);
+    d0 = fake_oled.data_bytes;
+    MEASURE("clear",             oled_clear(), b);
+    TEST_ASSERT_EQUAL_UINT32(8 * OLED_WIDTH, fake_oled.data_bytes - d0);
+    MEASURE("radio full",        oled_show_radio_screen(10700, 10, 25, false), full);
+    MEASURE("radio same",        oled_show_radio_screen(10700, 10, 25, false), b);
+    MEASURE("freq same",         oled_show_freq(10700), b);
+    if (FREQ_BUFFERED) TEST_ASSERT_EQUAL_UINT32(0, b);
+    MEASURE("rssi 25->26",       oled_show_radio_screen(10700, 10, 26, false), b);
+    MEASURE("volume 10->9",      oled_show_radio_screen(10700, 9, 26, false), b);
+    MEASURE("freq 107.0->99.5",  oled_show_radio_screen(9950, 9, 26, false), b);
+    MEASURE("freq 99.5->99.6",   oled_show_radio_screen(9960, 9, 26, false), step);
+    MEASURE("mute",              oled_show_radio_screen(9960, 9, 26, true), b);
+    MEASURE("unmute",            oled_show_radio_screen(9960, 9, 26, false), b);
+    MEASURE("power off",         oled_show_power_off(), b);
+    TEST_ASSERT_EQUAL_UINT16(0, fake_oled.ram_viol);
+    if (FREQ_BUFFERED) TEST_ASSERT_TRUE(step < full);   // len zmenené stĺpce frekvencie
+}
+
+/**
+ * @brief Cena jednotlivých prvkov, ako ich kreslí model obrazovky (screen.cpp) pri zmene.
+ */
+void test_screen_element_bytes(void)
+{
+    uint32_t b, first, step;
+
+    oled_clear();
+    MEASURE("freq first",        oled_show_freq(10700), first);
+    MEASURE("freq same",         oled_show_freq(10700), b);
+    if (FREQ_BUFFERED) TEST_ASSERT_EQUAL_UINT32(0, b);
+    MEASURE("freq 107.0->99.5",  oled_show_freq(9950), b);
+    MEASURE("freq 99.5->99.6",   oled_show_freq(9960), step);
+    if (FREQ_BUFFERED) TEST_ASSERT_TRUE(step < first);
+    MEASURE("rssi 25->31",       oled_show_rssi(31), b);
+    MEASURE("volume 10->11",     oled_show_volume(11), b);
+    MEASURE("header mute",       oled_show_header(true, true), b);
+    MEASURE("mode TUNE",         oled_show_mode(true), b);
+    TEST_ASSERT_EQUAL_UINT16(0, fake_oled.ram_viol);
+}
+
+/**
+ * @brief Najmenší počet stĺpcov stránky bežiaceho riadku, ktoré sa líšia od ideálneho obrazu.
+ *
+ * Ideálny obraz = 128 po sebe idúcich stĺpcov prúdu textu pri ľubovoľnej polohe.
+ */
+static uint8_t ticker_wrong_cols(void)
+{
+    uint8_t best = OLED_WIDTH;
+
+    for (uint16_t x = 0; x < s_tick_lap && best; x++) {
+        uint8_t bad = 0;
+        for (uint8_t a = 0; a < OLED_WIDTH && bad < best; a++)
+            if (fake_oled.gram[OLED_TICKER_PAGE][a] != oled_ticker_col(x + a)) bad++;
+        if (bad < best) best = bad;
+    }
+    return best;
+}
+
+/**
+ * @brief Beží bežiaci riadok @p secs sekúnd so snímkou každých 50 ms.
+ *
+ * @param text      RadioText.
+ * @param secs      Trvanie v sekundách (meria sa od 5. s).
+ * @param redraw    Každú sekundu prekresliť aj iný prvok – posun sa zastavuje
+ *                  aj kvôli cudzím zápisom (ich bajty sa započítajú).
+ * @param wrong_max Výstup – najviac nesprávnych stĺpcov pri kontrolách.
+ * @return Bajty za sekundu od 5. sekundy.
+ */
+static uint32_t run_ticker(const char *text, unsigned secs, bool redraw, uint8_t *wrong_max)
+{
+    uint32_t b0 = 0;
+
+    *wrong_max = 0;
+    oled_ticker_text(text);
+    drain();
+    for (unsigned long ms = 1; ms <= secs * 1000UL; ms++) {
+        fake_delay_us(1000);
+        if (ms % 50) continue;
+
+        if (redraw && ms % 1000 == 0) oled_draw_string(3, 0, (ms / 1000) & 1 ? "A" : "B");
+        oled_ticker_poll();
+        drain();
+        uint8_t w = ticker_wrong_cols();
+        if (w > *wrong_max) *wrong_max = w;
+        if (ms == 5000) b0 = fake_bus.bytes;
+    }
+    return (fake_bus.bytes - b0) / (secs - 5);
+}
+
+/**
+ * @brief Bežiaci riadok s hardvérovým posunom (meranie k [user-024]).
+ */
+void test_ticker_scroll(void)
+{
+    uint8_t wrong;
+    char line[96];
+
+    fake_oled.scroll_step_us = OLED_TICKER_STEP_US;
+    oled_clear();
+
+    uint32_t bps = run_ticker("RADIO EXPRESS - the best hits of 80s, 90s and today! Listen now.", 65, true, &wrong);
+    snprintf(line, sizeof(line), "ticker 64 chars %5lu B/s, wrong cols max %u, RAM writes while scrolling %u",
+             (unsigned long)bps, wrong, fake_oled.ram_viol);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_EQUAL_UINT16(0, fake_oled.ram_viol);
+    TEST_ASSERT_TRUE(wrong <= 6);                  // menej ako jeden znak na pravom okraji
+    TEST_ASSERT_TRUE(fake_oled.scroll_starts > 0);
+
+    oled_clear();
+    bps = run_ticker("RADIO EXPRESS - the best hits of 80s, 90s and today! Listen now.", 65, false, &wrong);
+    snprintf(line, sizeof(line), "ticker 64 chars %5lu B/s without other drawing, wrong cols max %u",
+             (unsigned long)bps, wrong);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_EQUAL_UINT16(0, fake_oled.ram_viol);
+
+    // Kratší text bez mazania – starý koniec zmizne, na displeji ostane len nový text
+    run_ticker("Kratsi RadioText, 31 znakov ...", 20, false, &wrong);
+    wrong = ticker_wrong_cols();
+    snprintf(line, sizeof(line), "ticker 64 -> 31 chars, wrong cols %u", wrong);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_TRUE(wrong <= 6);
+    TEST_ASSERT_EQUAL_UINT16(0, fake_oled.ram_viol);
+
+    oled_clear();
+    uint32_t idle = run_ticker("Hello FM", 30, false, &wrong);
+    snprintf(line, sizeof(line), "ticker 8 chars  %5lu B/s", (unsigned long)idle);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_EQUAL_UINT32(0, idle);
+    TEST_ASSERT_EQUAL_UINT8(0, wrong);
+    TEST_ASSERT_EQUAL_UINT16(0, fake_oled.ram_viol);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_radio_screen_bytes);
+    RUN_TEST(test_screen_element_bytes);
+    RUN_TEST(test_ticker_scroll);
+    return UNITY_END();
+}
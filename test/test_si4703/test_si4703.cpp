@@ -0,0 +1,199 @@
+/**
+ * @file test_si4703.cpp
+ * @brief Natívny test dokončenia tune/seek z prerušenia GPIO2 (pio test -e native).
+ *
+ * Ovládač Si4703 beží proti modelu tunera (fake_si4703.h) na modeli TWI
+ * (fake_hw.h). GPIO2 je na PC2, takže globálny @c radio používa cestu
+ * s prerušením: @ref Si4703::poll počas ladenia nečíta zbernicu, kým
+ * pin-change prerušenie PCINT1 nenastaví príznak pre takeIrq(). Pri
+ * stratenom impulze číta stav až záložné čítanie po INT_FALLBACK_MS.
+ */
+#define SI4703_INT_PIN PC2
+
+#include "twi.c"
+#include "gpio.c"
+#include "wire3.c"
+#include "rds.cpp"
+#include "Si4703.cpp"
+
+#include "fake_si4703.h"
+#include <unity.h>
+
+/// Trvanie tuningu a seeku v modeli tunera (ms).
+#define TUNE_MS 30
+#define SEEK_MS 300
+
+/// Záložné čítanie bez hrany GPIO2 (= Si4703::INT_FALLBACK_MS).
+#define FALLBACK_MS 500
+
+/**
+ * @brief Volá poll() každú 1 ms, kým ladenie beží.
+ *
+ * @param si       Ovládač.
+ * @param limit_ms Najdlhší čas volania.
+ * @param reads    Výstup – čítania tunera počas behu.
+ * @param done_ms  Výstup – čas od štartu do výsledku v ms.
+ * @return Výsledok ladenia.
+ */
+static Si4703::tuneStatus_t run_until_done(Si4703 &si, unsigned limit_ms, uint16_t *reads, unsigned *done_ms)
+{
+    uint16_t r0 = fake_si.reads;
+    Si4703::tuneStatus_t st = Si4703::TUNE_BUSY;
+    unsigned t = 0;
+
+    while (t < limit_ms && (st = si.poll()) == Si4703::TUNE_BUSY) {
+        fake_run_ms(1);
+        t++;
+    }
+    *reads   = fake_si.reads - r0;
+    *done_ms = t;
+    return st;
+}
+
+void setUp(void)
+{
+    fake_bus_reset();
+    fake_si_reset(TUNE_MS, SEEK_MS);
+    radio.start();
+    fake_run_ms(10);
+}
+
+void tearDown(void)
+{
+}
+
+/**
+ * @brief Kým nepríde impulz GPIO2, poll() nečíta zbernicu; po ňom tuning dobehne.
+ */
+void test_tune_waits_for_gpio2_without_reads(void)
+{
+    uint16_t reads;
+    unsigned done_ms;
+
+    radio.beginTune(10150);
+    uint16_t r0 = fake_si.reads;
+
+    for (unsigned t = 0; t < TUNE_MS - 1; t++) {
+        TEST_ASSERT_EQUAL(Si4703::TUNE_BUSY, radio.poll());
+        fake_run_ms(1);
+    }
+    TEST_ASSERT_EQUAL_UINT16(0, fake_si.reads - r0);
+
+    TEST_ASSERT_EQUAL(Si4703::TUNE_DONE, run_until_done(radio, 50, &reads, &done_ms));
+    TEST_ASSERT_TRUE(done_ms <= 3);
+    TEST_ASSERT_EQUAL_UINT16(2, reads);             // STC = 1, potom STC = 0
+    TEST_ASSERT_EQUAL(10150, radio.getChannel());
+}
+
+/**
+ * @brief Predčasný impulz GPIO2 (pred STC) spôsobí jedno čítanie, potom sa opäť čaká bez čítania.
+ */
+void test_early_gpio2_is_taken_once(void)
+{
+    radio.beginTune(9000);
+    fake_run_ms(5);
+
+    uint16_t r0 = fake_si.reads;
+    fake_si_pulse();                                // napr. rušenie na linke
+    TEST_ASSERT_EQUAL(Si4703::TUNE_BUSY, radio.poll());
+    TEST_ASSERT_EQUAL_UINT16(1, fake_si.reads - r0);
+
+    for (unsigned t = 0; t < 10; t++) {
+        TEST_ASSERT_EQUAL(Si4703::TUNE_BUSY, radio.poll());
+        fake_run_ms(1);
+    }
+    TEST_ASSERT_EQUAL_UINT16(1, fake_si.reads - r0);
+}
+
+/**
+ * @brief Neskorý impulz po stratenom STC impulze – tuning dobehne hneď, bez čakania na záložné čítanie.
+ */
+void test_late_gpio2_completes_tune(void)
+{
+    uint16_t reads;
+    unsigned done_ms;
+
+    fake_si.irq_lost = true;
+    radio.beginTune(9000);
+    fake_run_ms(TUNE_MS + 1);
+    TEST_ASSERT_EQUAL(Si4703::TUNE_BUSY, radio.poll());
+
+    fake_si_pulse();
+    TEST_ASSERT_EQUAL(Si4703::TUNE_DONE, run_until_done(radio, 50, &reads, &done_ms));
+    TEST_ASSERT_TRUE(done_ms <= 1);
+    TEST_ASSERT_EQUAL_UINT16(2, reads);
+    TEST_ASSERT_EQUAL(9000, radio.getChannel());
+}
+
+/**
+ * @brief Pri stratenom impulze dobehne seek až záložným čítaním po INT_FALLBACK_MS.
+ */
+void test_lost_edge_falls_back_after_timeout(void)
+{
+    uint16_t reads;
+    unsigned done_ms;
+
+    fake_si.irq_lost = true;
+    radio.beginSeek(Si4703::SEEK_UP);
+
+    TEST_ASSERT_EQUAL(Si4703::TUNE_DONE, run_until_done(radio, 2000, &reads, &done_ms));
+    TEST_ASSERT_TRUE(done_ms >= FALLBACK_MS);
+    TEST_ASSERT_TRUE(done_ms <= FALLBACK_MS + 2);
+    TEST_ASSERT_EQUAL_UINT16(2, reads);             // záložné čítanie, potom STC = 0
+    TEST_ASSERT_EQUAL(8750 + 10 * 40, radio.getChannel());
+}
+
+/**
+ * @brief Bez GPIO2 (intPin = 0) sa STC zisťuje čítaním pri každom poll().
+ */
+void test_polling_mode_reads_every_poll(void)
+{
+    Si4703 polled(PD4, PC4, PC5, 0);
+    uint16_t reads;
+    unsigned done_ms;
+
+    polled.start();
+    fake_run_ms(10);
+    polled.beginTune(10150);
+
+    TEST_ASSERT_EQUAL(Si4703::TUNE_DONE, run_until_done(polled, 200, &reads, &done_ms));
+    TEST_ASSERT_TRUE(done_ms >= TUNE_MS - 1);
+    TEST_ASSERT_TRUE(reads >= done_ms);
+}
+
+/**
+ * @brief Rovnaký seek s prerušením GPIO2 a bez neho – s GPIO2 len zlomok čítaní zbernice.
+ */
+void test_seek_gpio2_vs_polling_reads(void)
+{
+    Si4703 polled(PD4, PC4, PC5, 0);
+    uint16_t reads_int, reads_poll;
+    unsigned done_int, done_poll;
+
+    radio.beginSeek(Si4703::SEEK_UP);
+    TEST_ASSERT_EQUAL(Si4703::TUNE_DONE, run_until_done(radio, 2000, &reads_int, &done_int));
+
+    polled.start();
+    fake_run_ms(10);
+    polled.beginSeek(Si4703::SEEK_UP);
+    TEST_ASSERT_EQUAL(Si4703::TUNE_DONE, run_until_done(polled, 2000, &reads_poll, &done_poll));
+
+    TEST_ASSERT_TRUE(done_int  <= SEEK_MS + 2);
+    TEST_ASSERT_TRUE(done_poll <= SEEK_MS + 2);
+    TEST_ASSERT_EQUAL_UINT16(2, reads_int);          // STC = 1, potom STC = 0
+    TEST_ASSERT_TRUE(reads_poll >= SEEK_MS - 1);     // jedno čítanie na každý poll()
+    TEST_ASSERT_EQUAL(8750 + 10 * 40, radio.getChannel());
+    TEST_ASSERT_EQUAL(8750 + 10 * 40, polled.getChannel());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_tune_waits_for_gpio2_without_reads);
+    RUN_TEST(test_early_gpio2_is_taken_once);
+    RUN_TEST(test_late_gpio2_completes_tune);
+    RUN_TEST(test_lost_edge_falls_back_after_timeout);
+    RUN_TEST(test_polling_mode_reads_every_poll);
+    RUN_TEST(test_seek_gpio2_vs_polling_reads);
+    return UNITY_END();
+}
@@ -0,0 +1,316 @@
+/**
+ * @file test_twi.cpp
+ * @brief Natívny test zotavenia TWI zbernice a počítadiel chýb (pio test -e native).
+ *
+ * Chyby sa vnášajú v modeli zbernice (fake_hw.h): zaseknutá jednotka
+ * (TWINT nepríde), slave držiaci SDA, SCL trvalo v nule a NACK adresy
+ * alebo dátového bajtu. Overuje sa @ref twi_recover (počet hodín SCL,
+ * výsledok), @ref TWI_XF_TIMEOUT po @ref TWI_TIMEOUT_US, počítadlá
+ * @ref twi_get_errors, obnova po neodoslanom STOP až mimo automatu fronty
+ * (ISR) a politika opakovania ovládača Si4703. Plánovač
+ * fronty: čítanie tunera počas plnenia stránky displeja čaká najviac
+ * jeden úsek @ref TWI_SCHED_CHUNK.
+ */
+#include "twi.c"
+#include "gpio.c"
+#include "wire3.c"
+#include "rds.cpp"
+#include "Si4703.cpp"
+
+#include "fake_si4703.h"
+#include <stdio.h>
+#include <unity.h>
+
+/// Adresa Si4703 v 2-wire režime.
+#define SI_ADDR 0x10
+
+/// Adresa displeja SSD1306 a jeho riadiaci bajt pre dáta.
+#define OLED_SINK_ADDR 0x3C
+#define OLED_SINK_DATA 0x40
+
+/** @brief Slave na adrese displeja – potvrdí a zahodí všetky zápisy. */
+static bool    sink_start(bool rd)   { return !rd; }
+static bool    sink_write(uint8_t b) { return true; }
+static uint8_t sink_read(void)       { return 0xFF; }
+static void    sink_stop(void)       { }
+
+static const fake_slave_t sink_slave = {
+    OLED_SINK_ADDR, sink_start, sink_write, sink_read, sink_stop, 0
+};
+
+/// Adresa slave, ktorý po poslednom bajte zasekne jednotku (STOP neodíde).
+#define STOP_HANG_ADDR 0x3D
+
+/// Bajty do zaseknutia (@ref stophang_write).
+static uint8_t stop_hang_left;
+
+static bool stophang_write(uint8_t b)
+{
+    if (stop_hang_left && !--stop_hang_left) fake_bus.hang = true;
+    return true;
+}
+
+static const fake_slave_t stophang_slave = {
+    STOP_HANG_ADDR, sink_start, stophang_write, sink_read, sink_stop, 0
+};
+
+/// Hodiny SCL z obnovy v čase, keď automat fronty ohlásil výsledok.
+static uint16_t done_clocks;
+
+static void record_done(twi_xfer_t *x)
+{
+    done_clocks = fake_bus.scl_clocks;
+}
+
+/// Pokusy ovládača Si4703 na jednu transakciu (= Si4703::I2C_FAIL_MAX).
+#define SI_FAIL_MAX 10
+
+void setUp(void)
+{
+    fake_bus_reset();
+    fake_si_reset(30, 300);
+    fake_bus_attach(&sink_slave);
+    fake_bus_attach(&stophang_slave);
+    SREG = 0;
+    twi_init();
+    twi_recover();
+    fake_bus.scl_clocks = 0;
+    twi_clear_errors(SI_ADDR);
+}
+
+void tearDown(void)
+{
+}
+
+/**
+ * @brief Čítanie dvoch registrov tunera cez frontu.
+ */
+static uint8_t read_status(twi_xfer_t *x, uint8_t *buf)
+{
+    memset(x, 0, sizeof(*x));
+    x->addr = SI_ADDR;
+    x->rbuf = buf;
+    x->rlen = 4;
+    return twi_transfer(x);
+}
+
+/**
+ * @brief Slave drží SDA tri bity – obnova ho vyhodí tromi hodinami, potom STOP.
+ */
+void test_recover_clocks_out_held_sda(void)
+{
+    fake_bus.sda_hold = 3;
+
+    TEST_ASSERT_EQUAL_UINT8(0, twi_recover());
+    TEST_ASSERT_EQUAL_UINT16(3 + 1, fake_bus.scl_clocks);
+    TEST_ASSERT_TRUE(PINC & (1 << PC4));
+    TEST_ASSERT_TRUE(TWCR & (1 << TWEN));
+}
+
+/**
+ * @brief SDA trvalo v nule – najviac 9 hodín, STOP a výsledok 1.
+ */
+void test_recover_gives_up_after_nine_clocks(void)
+{
+    fake_bus.sda_hold = 20;
+
+    TEST_ASSERT_EQUAL_UINT8(1, twi_recover());
+    TEST_ASSERT_EQUAL_UINT16(9 + 1, fake_bus.scl_clocks);
+}
+
+/**
+ * @brief SCL trvalo v nule – obnova hlási zaseknutú zbernicu.
+ */
+void test_recover_reports_stuck_scl(void)
+{
+    fake_bus.scl_stuck = true;
+
+    TEST_ASSERT_EQUAL_UINT8(1, twi_recover());
+}
+
+/**
+ * @brief Zaseknutá jednotka: transakcia skončí TWI_XF_TIMEOUT, zbernica sa obnoví a ďalšia prejde.
+ */
+void test_hang_times_out_and_recovers(void)
+{
+    twi_xfer_t x;
+    uint8_t buf[4];
+    twi_errors_t e;
+
+    fake_bus.hang = true;
+    unsigned long t0 = fake_us;
+
+    TEST_ASSERT_EQUAL_UINT8(TWI_XF_TIMEOUT, read_status(&x, buf));
+    TEST_ASSERT_TRUE(fake_us - t0 >= TWI_TIMEOUT_US);
+    TEST_ASSERT_TRUE(fake_us - t0 < 2 * TWI_TIMEOUT_US);
+    TEST_ASSERT_TRUE(fake_bus.scl_clocks >= 1);     // STOP z obnovy
+    twi_get_errors(SI_ADDR, &e);
+    TEST_ASSERT_EQUAL_UINT16(1, e.timeout);
+    TEST_ASSERT_EQUAL_UINT16(0, e.nack);
+
+    fake_bus.hang = false;
+    TEST_ASSERT_EQUAL_UINT8(TWI_XF_OK, read_status(&x, buf));
+    TEST_ASSERT_EQUAL_UINT8(4, x.count);
+}
+
+/**
+ * @brief STOP, ktorý neodíde, automat (ISR) len ohlási – zbernicu obnoví až čakacia slučka.
+ */
+void test_stop_timeout_recovers_outside_step(void)
+{
+    twi_xfer_t x = { 0 };
+    uint8_t buf[4];
+    const uint8_t data[3] = { 1, 2, 3 };
+    twi_errors_t e;
+
+    x.addr = STOP_HANG_ADDR;
+    x.wbuf = data;
+    x.wlen = sizeof(data);
+    x.done = record_done;
+    stop_hang_left = sizeof(data);
+    done_clocks = 0xFFFF;
+
+    TEST_ASSERT_EQUAL_UINT8(TWI_XF_TIMEOUT, twi_transfer(&x));
+    TEST_ASSERT_EQUAL_UINT8(sizeof(data), x.count);
+    TEST_ASSERT_EQUAL_UINT16(0, done_clocks);       // v automate žiadna obnova
+    TEST_ASSERT_TRUE(fake_bus.scl_clocks >= 1);     // STOP z obnovy v twi_wait
+    twi_get_errors(STOP_HANG_ADDR, &e);
+    TEST_ASSERT_EQUAL_UINT16(1, e.timeout);
+
+    fake_bus.hang = false;
+    TEST_ASSERT_EQUAL_UINT8(TWI_XF_OK, read_status(&x, buf));
+}
+
+/**
+ * @brief Bajtový prístup pri zaseknutej jednotke – timeout a do ďalšieho START sa nevysiela.
+ */
+void test_byte_access_times_out(void)
+{
+    twi_errors_t e;
+
+    twi_start();
+    fake_bus.hang = true;                           // zasekne sa po START
+    TEST_ASSERT_EQUAL_UINT8(1, twi_write(SI_ADDR << 1));
+    twi_get_errors(SI_ADDR, &e);
+    TEST_ASSERT_EQUAL_UINT16(1, e.timeout);
+
+    fake_bus.hang = false;
+    uint32_t bytes = fake_bus.bytes;
+    TEST_ASSERT_EQUAL_UINT8(1, twi_write(0x00));    // po timeoute sa nevysiela
+    TEST_ASSERT_EQUAL_UINT32(bytes, fake_bus.bytes);
+    twi_stop();
+
+    twi_start();
+    TEST_ASSERT_EQUAL_UINT8(0, twi_write(SI_ADDR << 1));
+    twi_stop();
+}
+
+/**
+ * @brief NACK adresy a dátového bajtu – stav transakcie a počítadlo nack.
+ */
+void test_nack_sets_status_and_counter(void)
+{
+    twi_xfer_t x;
+    uint8_t buf[4];
+    const uint8_t data[4] = { 0x40, 0x01, 0x00, 0x00 };
+    twi_errors_t e;
+
+    fake_bus.nack_addr = 1;
+    TEST_ASSERT_EQUAL_UINT8(TWI_XF_NACK_ADDR, read_status(&x, buf));
+
+    memset(&x, 0, sizeof(x));
+    x.addr = SI_ADDR;
+    x.wbuf = data;
+    x.wlen = sizeof(data);
+    fake_bus.nack_data_at = 1;
+    TEST_ASSERT_EQUAL_UINT8(TWI_XF_NACK_DATA, twi_transfer(&x));
+    TEST_ASSERT_EQUAL_UINT8(1, x.count);
+
+    twi_get_errors(SI_ADDR, &e);
+    TEST_ASSERT_EQUAL_UINT16(2, e.nack);
+    TEST_ASSERT_EQUAL_UINT16(0, e.timeout);
+
+    fake_bus.nack_data_at = -1;
+    TEST_ASSERT_EQUAL_UINT8(TWI_XF_OK, read_status(&x, buf));
+    twi_clear_errors(SI_ADDR);
+    twi_get_errors(SI_ADDR, &e);
+    TEST_ASSERT_EQUAL_UINT16(0, e.nack);
+}
+
+/**
+ * @brief Si4703: krátky výpadok sa prekoná opakovaním, dlhý skončí poruchou zbernice.
+ */
+void test_si4703_retries_then_reports_fault(void)
+{
+    Si4703 si;
+
+    si.start();
+    si.resetBusStats();
+
+    fake_bus.nack_addr = 3;
+    si.readRegisters(2);
+    TEST_ASSERT_EQUAL_UINT16(3, si.getBusStats().retries);
+    TEST_ASSERT_EQUAL_UINT16(0, si.getBusStats().failures);
+    TEST_ASSERT_FALSE(si.isBusFault());
+
+    fake_bus.nack_addr = 20;
+    si.readRegisters(2);
+    TEST_ASSERT_EQUAL_UINT16(3 + SI_FAIL_MAX - 1, si.getBusStats().retries);
+    TEST_ASSERT_EQUAL_UINT16(1, si.getBusStats().failures);
+    TEST_ASSERT_TRUE(si.isBusFault());
+
+    fake_bus.nack_addr = 0;
+    si.readRegisters(2);
+    TEST_ASSERT_FALSE(si.isBusFault());
+}
+
+/**
+ * @brief Čítanie tunera zaradené počas plnenia stránky čaká najviac jeden úsek plánovača.
+ */
+void test_tuner_read_waits_one_chunk(void)
+{
+    static const uint8_t zero = 0;
+    uint8_t r[4];
+    twi_xfer_t fill = { 0 }, tuner = { 0 };
+    twi_sched_stats_t hi, lo;
+    char line[64];
+
+    fill.addr  = OLED_SINK_ADDR;
+    fill.flags = TWI_XF_REG | TWI_XF_FILL | TWI_XF_LOW | TWI_XF_CHUNK;
+    fill.reg   = OLED_SINK_DATA;
+    fill.wbuf  = &zero;
+    fill.wlen  = 128;                               // celá stránka
+    tuner.addr = SI_ADDR;
+    tuner.rbuf = r;
+    tuner.rlen = sizeof(r);
+
+    twi_sched_clear_stats();
+    twi_submit(&fill);                              // beží – START už odišiel
+    twi_submit(&tuner);
+    twi_wait(&tuner);
+    twi_wait(&fill);
+    twi_sched_get_stats(TWI_PRIO_HIGH, &hi);
+    twi_sched_get_stats(TWI_PRIO_LOW, &lo);
+
+    snprintf(line, sizeof(line), "tuner wait max %u B, page fill yields %u", hi.wait_max, lo.yields);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_EQUAL_UINT8(TWI_XF_OK, tuner.status);
+    TEST_ASSERT_EQUAL_UINT8(TWI_XF_OK, fill.status);
+    TEST_ASSERT_TRUE(hi.wait_max <= TWI_SCHED_CHUNK + 2);  // úsek + SLA + riadiaci bajt
+    TEST_ASSERT_TRUE(lo.yields >= 1);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_recover_clocks_out_held_sda);
+    RUN_TEST(test_recover_gives_up_after_nine_clocks);
+    RUN_TEST(test_recover_reports_stuck_scl);
+    RUN_TEST(test_hang_times_out_and_recovers);
+    RUN_TEST(test_stop_timeout_recovers_outside_step);
+    RUN_TEST(test_byte_access_times_out);
+    RUN_TEST(test_nack_sets_status_and_counter);
+    RUN_TEST(test_si4703_retries_then_reports_fault);
+    RUN_TEST(test_tuner_read_waits_one_chunk);
+    return UNITY_END();
+}
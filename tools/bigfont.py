@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""
+Generátor veľkého fontu frekvencie (oled.cpp, font_tall).
+
+Znaky 5x7 sa zväčšia na 10x14 algoritmom Scale2x (EPX) – šikmé hrany
+sa vyhladia, nie sú to len zdvojené pixely – a uložia sa ako stĺpce
+dvoch stránok SSD1306 (16 riadkov, 1 riadok okraj hore a dole):
+najprv 10 bajtov hornej stránky, potom 10 bajtov dolnej. Bodka má
+šírku 4 stĺpce, ostatné znaky 10.
+
+Výstup (C tabuľka do oled.cpp) ide na štandardný výstup:
+  tools/bigfont.py
+"""
+
+# Znaky 5x7 (stĺpce, bit 0 = horný riadok) – číslice a M, H, z z fontu
+# v oled.cpp, bodka na účarí (v malom fonte je bodka v strede riadku).
+GLYPHS = [
+    (" ", [0x00, 0x00, 0x00, 0x00, 0x00]),
+    ("0", [0x3E, 0x51, 0x49, 0x45, 0x3E]),
+    ("1", [0x00, 0x42, 0x7F, 0x40, 0x00]),
+    ("2", [0x42, 0x61, 0x51, 0x49, 0x46]),
+    ("3", [0x21, 0x41, 0x45, 0x4B, 0x31]),
+    ("4", [0x18, 0x14, 0x12, 0x7F, 0x10]),
+    ("5", [0x27, 0x45, 0x45, 0x45, 0x39]),
+    ("6", [0x3C, 0x4A, 0x49, 0x49, 0x30]),
+    ("7", [0x01, 0x71, 0x09, 0x05, 0x03]),
+    ("8", [0x36, 0x49, 0x49, 0x49, 0x36]),
+    ("9", [0x06, 0x49, 0x49, 0x29, 0x1E]),
+    (".", [0x60, 0x60]),
+    ("M", [0x7F, 0x02, 0x0C, 0x02, 0x7F]),
+    ("H", [0x7F, 0x08, 0x08, 0x08, 0x7F]),
+    ("z", [0x44, 0x64, 0x54, 0x4C, 0x44]),
+]
+
+WIDTH = 10      # stĺpce v tabuľke na znak
+TOP = 1         # prázdne riadky nad znakom
+
+
+def scale2x(cols):
+    """Scale2x nad bitmapou 5x7 -> (2*w)x14, vráti pole riadkov [y][x]."""
+    w, h = len(cols), 7
+    px = lambda x, y: 0 <= x < w and 0 <= y < h and (cols[x] >> y) & 1
+
+    out = [[0] * (2 * w) for _ in range(2 * h)]
+    for y in range(h):
+        for x in range(w):
+            p = px(x, y)
+            a, b, c, d = px(x, y - 1), px(x + 1, y), px(x - 1, y), px(x, y + 1)
+            e0 = c if (c == a and c != d and a != b) else p
+            e1 = a if (a == b and a != c and b != d) else p
+            e2 = c if (d == c and d != b and c != a) else p
+            e3 = b if (b == d and b != a and d != c) else p
+            out[2 * y][2 * x], out[2 * y][2 * x + 1] = e0, e1
+            out[2 * y + 1][2 * x], out[2 * y + 1][2 * x + 1] = e2, e3
+    return out
+
+
+def pages(rows):
+    """Riadky [y][x] -> (horná stránka, dolná stránka) po WIDTH bajtoch."""
+    w = len(rows[0])
+    top, bottom = [0] * WIDTH, [0] * WIDTH
+    for y, row in enumerate(rows):
+        yy = y + TOP
+        for x in range(w):
+            if row[x]:
+                if yy < 8:
+                    top[x] |= 1 << yy
+                else:
+                    bottom[x] |= 1 << (yy - 8)
+    return top, bottom
+
+
+def main():
+    print("static const uint8_t font_tall[FONT_TALL_COUNT][2][FONT_TALL_W] PROGMEM = {")
+    for ch, cols in GLYPHS:
+        top, bottom = pages(scale2x(cols))
+        hexs = lambda v: ", ".join("0x%02X" % b for b in v)
+        print("    { { %s },   // '%s', šírka %d" % (hexs(top), ch, 2 * len(cols)))
+        print("      { %s } }," % hexs(bottom))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+Prehľad vyťaženia I2C zbernice zo záznamu tracera (twi.c, TWI_TRACE = 1).
+
+Vstup je surový záznam sériovej linky (napr. `pio device monitor --raw`
+presmerovaný do súboru, alebo `cat /dev/ttyACM0 > capture.bin`). Textové
+výpisy firmvéru medzi binárnymi blokmi sa preskočia.
+
+Výstup:
+  - bajty/s, počet transakcií a chyby pre každé zariadenie,
+  - percento času, keď je zbernica obsadená,
+  - histogram veľkosti transakcií.
+
+Použitie:
+  tools/twi_trace.py capture.bin
+  tools/twi_trace.py - < capture.bin
+"""
+
+import argparse
+import struct
+import sys
+from collections import defaultdict
+
+MAGIC = b"\xa5\x5a"
+HEADER = struct.Struct("<BBBH")         # verzia, tik µs, n, zahodené
+RECORD = struct.Struct("<BBBIH")        # adresa, info, bajty, začiatok, trvanie
+
+STATUS = {0: "ok", 1: "nack_addr", 2: "nack_data", 3: "error", 4: "arb_lost", 5: "timeout"}
+DIRECTION = {1: "W", 2: "R", 3: "WR"}
+DEVICES = {0x10: "Si4703", 0x3C: "OLED"}
+BUCKETS = [(0, 0), (1, 1), (2, 3), (4, 7), (8, 15), (16, 31), (32, 63), (64, 255)]
+
+
+def parse(data):
+    """Vráti (zoznam záznamov, tik µs, zahodené, poškodené bloky)."""
+    records, tick, dropped, bad = [], None, 0, 0
+    pos = 0
+
+    while True:
+        pos = data.find(MAGIC, pos)
+        if pos < 0 or pos + 2 + HEADER.size > len(data):
+            break
+        body = pos + 2
+        version, tick_us, n, lost = HEADER.unpack_from(data, body)
+        end = body + HEADER.size + n * RECORD.size
+        if version != 1 or end >= len(data) or (sum(data[body:end]) & 0xFF) != data[end]:
+            bad += 1
+            pos += 1
+            continue
+
+        tick = tick_us
+        dropped += lost
+        for i in range(n):
+            addr, info, count, start, dur = RECORD.unpack_from(data, body + HEADER.size + i * RECORD.size)
+            records.append((addr, info >> 6, info & 0x07, count, start, dur))
+        pos = end + 1
+
+    return records, tick, dropped, bad
+
+
+def report(records, tick, dropped, bad, out):
+    if not records:
+        print("Žiadne záznamy (chýba TWI_TRACE = 1 alebo zlá rýchlosť UART?)", file=out)
+        return
+
+    first = min(r[4] for r in records)
+    last = max(r[4] + r[5] for r in records)
+    span_s = max(last - first, 1) * tick / 1e6
+    busy_s = sum(r[5] for r in records) * tick / 1e6
+
+    print(f"Záznam: {len(records)} transakcií za {span_s:.3f} s"
+          f" (zahodené {dropped}, poškodené bloky {bad})", file=out)
+    print(f"Zbernica obsadená: {100.0 * busy_s / span_s:.1f} %", file=out)
+    print(file=out)
+
+    per_dev = defaultdict(lambda: {"n": 0, "bytes": 0, "busy": 0, "err": defaultdict(int), "dir": defaultdict(int)})
+    hist = defaultdict(int)
+    for addr, direction, status, count, start, dur in records:
+        d = per_dev[addr]
+        d["n"] += 1
+        d["bytes"] += count
+        d["busy"] += dur
+        d["dir"][DIRECTION.get(direction, "?")] += 1
+        if status:
+            d["err"][STATUS.get(status, str(status))] += 1
+        for lo, hi in BUCKETS:
+            if lo <= count <= hi:
+                hist[(lo, hi)] += 1
+                break
+
+    print(f"{'zariadenie':<14}{'transakcie':>11}{'bajty/s':>10}{'obsadenie':>11}  smer / chyby", file=out)
+    for addr in sorted(per_dev):
+        d = per_dev[addr]
+        name = f"0x{addr:02X} {DEVICES.get(addr, '')}".rstrip()
+        dirs = " ".join(f"{k}:{v}" for k, v in sorted(d["dir"].items()))
+        errs = " ".join(f"{k}:{v}" for k, v in sorted(d["err"].items())) or "-"
+        busy = 100.0 * d["busy"] * tick / 1e6 / span_s
+        print(f"{name:<14}{d['n']:>11}{d['bytes'] / span_s:>10.0f}{busy:>10.1f}%  {dirs} / {errs}", file=out)
+    print(file=out)
+
+    print("Veľkosť transakcie (bajty):", file=out)
+    top = max(hist.values())
+    for lo, hi in BUCKETS:
+        n = hist.get((lo, hi), 0)
+        label = f"{lo}" if lo == hi else f"{lo}-{hi}"
+        print(f"  {label:>7} {n:>6} {'#' * (40 * n // top)}", file=out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("capture", help="súbor so záznamom UART alebo - pre stdin")
+    args = ap.parse_args()
+
+    data = sys.stdin.buffer.read() if args.capture == "-" else open(args.capture, "rb").read()
+    report(*parse(data), out=sys.stdout)
+
+
+if __name__ == "__main__":
+    main()